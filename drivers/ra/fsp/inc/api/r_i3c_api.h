@@ -140,6 +140,7 @@ typedef enum e_i3c_event
     I3C_EVENT_TIMEOUT_DETECTED,            ///< SCL is stuck at the logic high or logic low level during a transfer.
     I3C_EVENT_INTERNAL_ERROR,              ///< An internal error occurred.
     I3C_EVENT_SDA_WRITE_COMPLETE,          ///< An SDA (Short Data Argument) write transfer has completed.
+    I3C_EVENT_TRANSFER_LIST_COMPLETE,      ///< All transfers in a transfer list have completed, or one has failed.
 } i3c_event_t;
 
 /** The type of device. */
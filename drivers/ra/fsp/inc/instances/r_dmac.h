@@ -85,6 +85,56 @@ typedef struct st_dmac_extended_cfg
     void * p_context;
 } dmac_extended_cfg_t;
 
+/** Request executed by the DMAC channel pool. See @ref R_DMAC_PoolSubmit. */
+typedef struct st_dmac_pool_request
+{
+    transfer_info_t * p_info;            ///< Transfer to execute. The interrupt setting must be TRANSFER_IRQ_END.
+    elc_event_t       activation_source; ///< Event that triggers the transfer, ELC_EVENT_NONE for software start.
+    uint8_t           priority;          ///< Queue priority of the request. Lower values are scheduled first.
+
+    /** Follow-on request executed on the same channel after this request completes, or NULL. */
+    struct st_dmac_pool_request * p_next;
+
+    /** Called when the request completes, or NULL. Called from the DMAC interrupt, from @ref R_DMAC_PoolSubmit if
+     * the request cannot be started, or from @ref R_DMAC_PoolClose, after the pool has released its critical
+     * section. */
+    void (* p_callback)(dmac_callback_args_t * p_args);
+    void * p_context;                    ///< Passed to p_callback in ::transfer_callback_args_t.
+
+    volatile fsp_err_t err;              ///< Result of the request. Valid in p_callback.
+
+    struct st_dmac_pool_request * p_queue_next; ///< Used by the pool. Do not modify.
+} dmac_pool_request_t;
+
+struct st_dmac_pool_ctrl;
+
+/** Channel owned by the DMAC channel pool. */
+typedef struct st_dmac_pool_channel
+{
+    dmac_extended_cfg_t        extend;   ///< Set channel, irq and ipl before @ref R_DMAC_PoolOpen.
+    dmac_instance_ctrl_t       ctrl;     ///< Used by the pool. Do not modify.
+    transfer_cfg_t             cfg;      ///< Used by the pool. Do not modify.
+    struct st_dmac_pool_ctrl * p_pool;   ///< Used by the pool. Do not modify.
+    dmac_pool_request_t      * p_active; ///< Request in progress, or NULL if the channel is free.
+
+    /* Usage metrics, updated by the pool. */
+    volatile uint32_t requests_completed; ///< Number of requests completed on this channel
+    volatile uint32_t requests_chained;   ///< Number of follow-on requests started without returning to the queue
+} dmac_pool_channel_t;
+
+/** DMAC channel pool control block. DO NOT INITIALIZE. Initialization occurs when @ref R_DMAC_PoolOpen is called. */
+typedef struct st_dmac_pool_ctrl
+{
+    uint32_t              open;
+    dmac_pool_channel_t * p_channels;
+    uint8_t               num_channels;
+    dmac_pool_request_t * p_queue_head; ///< Pending requests sorted by priority
+
+    /* Usage metrics, updated by the pool. */
+    volatile uint32_t queue_depth;     ///< Number of pending requests
+    volatile uint32_t queue_depth_max; ///< Highest number of pending requests since open
+} dmac_pool_ctrl_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -124,6 +174,9 @@ fsp_err_t R_DMAC_CallbackSet(transfer_ctrl_t * const      p_api_ctrl,
                              void (                     * p_callback)(dmac_callback_args_t *),
                              void * const                 p_context,
                              dmac_callback_args_t * const p_callback_memory);
+fsp_err_t R_DMAC_PoolOpen(dmac_pool_ctrl_t * const p_pool, dmac_pool_channel_t * const p_channels, uint8_t num_channels);
+fsp_err_t R_DMAC_PoolSubmit(dmac_pool_ctrl_t * const p_pool, dmac_pool_request_t * const p_request);
+fsp_err_t R_DMAC_PoolClose(dmac_pool_ctrl_t * const p_pool);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
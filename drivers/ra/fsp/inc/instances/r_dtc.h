@@ -59,6 +59,15 @@ typedef struct st_dtc_instance_ctrl
     IRQn_Type irq;                     // Transfer activation IRQ number.
 } dtc_instance_ctrl_t;
 
+/** DTC chain builder. Composes register write, gather and scatter sequences into a chain of transfer_info_t entries
+ *  that is installed on an activation source with @ref R_DTC_ChainInstall. Initialize with @ref R_DTC_ChainInit. */
+typedef struct st_dtc_chain
+{
+    transfer_info_t * p_info;          ///< Chain storage. Must be declared with DTC_TRANSFER_INFO_ALIGNMENT.
+    uint16_t          max_entries;     ///< Number of entries available in the chain storage.
+    uint16_t          num_entries;     ///< Number of entries added to the chain.
+} dtc_chain_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -92,6 +101,26 @@ fsp_err_t R_DTC_CallbackSet(transfer_ctrl_t * const          p_api_ctrl,
                             void * const                     p_context,
                             transfer_callback_args_t * const p_callback_memory);
 fsp_err_t R_DTC_Close(transfer_ctrl_t * const p_api_ctrl);
+fsp_err_t R_DTC_ChainInit(dtc_chain_t * const p_chain, transfer_info_t * const p_info, uint16_t max_entries);
+fsp_err_t R_DTC_ChainRegisterWrite(dtc_chain_t * const p_chain,
+                                   void * const        p_reg,
+                                   void const * const  p_values,
+                                   transfer_size_t     size,
+                                   uint16_t            num_values);
+fsp_err_t R_DTC_ChainGather(dtc_chain_t * const p_chain,
+                            void const * const  p_regs,
+                            void * const        p_dest,
+                            transfer_size_t     size,
+                            uint16_t            num_regs,
+                            uint16_t            num_blocks);
+fsp_err_t R_DTC_ChainScatter(dtc_chain_t * const p_chain,
+                             void const * const  p_src,
+                             void * const        p_regs,
+                             transfer_size_t     size,
+                             uint16_t            num_regs,
+                             uint16_t            num_blocks);
+fsp_err_t R_DTC_ChainInstall(transfer_ctrl_t * const p_api_ctrl, dtc_chain_t * const p_chain);
+fsp_err_t R_DTC_ChainValidate(transfer_info_t const * const p_info, uint32_t max_entries, uint32_t * const p_num_entries);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -181,6 +181,24 @@ typedef struct st_glcdc_ctrl
                                        // (e.g. display_ctrl_t type data)
 } glcdc_ctrl_t;
 
+/** Arguments of the flip queue callback */
+typedef struct st_glcdc_flip_callback_args
+{
+    display_frame_layer_t layer;       ///< Layer that flipped
+    uint8_t             * p_released;  ///< Frame buffer that is no longer scanned out and can be drawn again
+    uint8_t             * p_displayed; ///< Frame buffer scanned out from this frame on
+    void                * p_context;   ///< Context passed to R_GLCDC_FlipCallbackSet
+} glcdc_flip_callback_args_t;
+
+/** Flip queue statistics */
+typedef struct st_glcdc_flip_stats
+{
+    uint32_t flips;                    ///< Queued frame buffers that were scanned out
+    uint32_t missed_flips;             ///< Frames in which a queued frame buffer had to wait for a pending update
+    uint32_t repeated_frames;          ///< Frames in which the flip queue of a used layer was empty
+    uint32_t underflows[2];            ///< Underflows of graphics planes 1 and 2
+} glcdc_flip_stats_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -218,6 +236,13 @@ fsp_err_t R_GLCDC_ColorKeySet(display_ctrl_t const * const p_api_ctrl,
                               display_colorkeying_layer_t  key_cfg,
                               display_frame_layer_t        layer);
 fsp_err_t R_GLCDC_StatusGet(display_ctrl_t const * const p_api_ctrl, display_status_t * const status);
+fsp_err_t R_GLCDC_FlipCallbackSet(display_ctrl_t * const p_api_ctrl,
+                                  void (                 * p_callback)(glcdc_flip_callback_args_t *),
+                                  void * const           p_context);
+fsp_err_t R_GLCDC_FlipQueue(display_ctrl_t * const p_api_ctrl,
+                            uint8_t * const        framebuffer,
+                            display_frame_layer_t  layer);
+fsp_err_t R_GLCDC_FlipStatsGet(display_ctrl_t * const p_api_ctrl, glcdc_flip_stats_t * const p_stats);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup GLCDC)
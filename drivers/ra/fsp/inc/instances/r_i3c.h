@@ -29,6 +29,11 @@ FSP_HEADER
 #define I3C_ERROR_RECOVERY_VERSION_2          (1U) ///< Support error recovery procedure for chip version 2.
 #define I3C_ERROR_RECOVERY_VERSION_BOTH       (2U) ///< Support error recovery procedure for chip version 1 and version 2.
 
+/** Number of IBI payload bytes (including the Mandatory Data Byte) stored in each @ref i3c_ibi_ring_entry_t. */
+#ifndef I3C_CFG_IBI_RING_PAYLOAD_SIZE
+ #define I3C_CFG_IBI_RING_PAYLOAD_SIZE        (8U)
+#endif
+
 /** Index for selecting the device defined in the extended address table. */
 #define I3C_DEVICE_INDEX_EXTENDED_DEVICE      (1U << 5U)
 
@@ -178,6 +183,46 @@ typedef struct s_i3c_write_buffer_descriptor
     uint32_t  buffer_size;             ///< Total size of the buffer.
 } i3c_write_buffer_descriptor_t;
 
+/** Descriptor for one transfer in a list started with @ref R_I3C_TransferListStart. */
+typedef struct s_i3c_transfer_descriptor
+{
+    uint32_t           device_index;   ///< Index of the target device in the device table.
+    i3c_bitrate_mode_t bitrate_mode;   ///< Bitrate setting. Select I3C_BITRATE_MODE_I3C_HDR_DDR_STDBR for HDR-DDR.
+
+    /** HDR-DDR command code. Write commands use 0x00 - 0x7F and read commands use 0x80 - 0xFF. Ignored for SDR and
+     * I2C transfers. */
+    uint8_t   command_code;
+    bool      rnw;                     ///< Set to true for a read transfer.
+    uint8_t * p_buffer;                ///< Buffer for reading or writing data.
+    uint32_t  length;                  ///< Length of the transfer in bytes. Must be a multiple of 2 for HDR-DDR.
+    uint32_t  transfer_size;           ///< Number of bytes transferred. Updated by the driver.
+    uint32_t  event_status;            ///< Status of the transfer (I3C_EVENT_STATUS_*). Updated by the driver.
+} i3c_transfer_descriptor_t;
+
+/** An IBI captured in an @ref i3c_ibi_ring_t. */
+typedef struct s_i3c_ibi_ring_entry
+{
+    uint32_t timestamp;                ///< Value of i3c_ibi_ring_t::p_timestamp_get when the IBI completed.
+    uint8_t  address;                  ///< Dynamic address of the device that sent the IBI.
+    uint8_t  mandatory_byte;           ///< The Mandatory Data Byte (first payload byte), or 0 if there was no payload.
+    uint8_t  length;                   ///< Number of bytes stored in the payload, including the Mandatory Data Byte.
+    uint8_t  event_status;             ///< Status of the IBI transfer (I3C_EVENT_STATUS_*).
+    uint8_t  payload[I3C_CFG_IBI_RING_PAYLOAD_SIZE]; ///< IBI payload. Bytes beyond this size are discarded.
+} i3c_ibi_ring_entry_t;
+
+/** Single-producer, single-consumer ring of captured IBIs (See @ref R_I3C_IbiRingSet). The driver only writes head
+ * and the application only writes tail, so entries can be drained without disabling interrupts. */
+typedef struct s_i3c_ibi_ring
+{
+    i3c_ibi_ring_entry_t * p_entries;   ///< Storage for captured IBIs.
+    uint32_t               num_entries; ///< Number of entries in p_entries. Must be a power of 2.
+    uint32_t (* p_timestamp_get)(void); ///< Returns a timestamp, for example a free running timer count. May be NULL.
+    volatile uint32_t head;             ///< Number of IBIs written by the driver.
+    volatile uint32_t tail;             ///< Number of IBIs read by the application.
+    volatile uint32_t overflow_count;   ///< Number of IBIs discarded because the ring was full.
+    volatile uint32_t truncated_count;  ///< Number of IBIs with a payload longer than I3C_CFG_IBI_RING_PAYLOAD_SIZE.
+} i3c_ibi_ring_t;
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref i3c_api_t::open is called. */
 typedef struct st_i3c_instance_ctrl
 {
@@ -196,6 +241,11 @@ typedef struct st_i3c_instance_ctrl
     i3c_read_buffer_descriptor_t  ibi_buffer_descriptor;       ///< Buffer descriptor for keeping track of an IBI read/write transfer.
     volatile uint32_t             read_transfer_count_final;   ///< The total number of bytes read during a read transfer.
     volatile uint32_t             ibi_transfer_count_final;    ///< The total number of bytes read during an IBI transfer.
+    i3c_transfer_descriptor_t   * p_transfer_list;             ///< Transfers started with @ref R_I3C_TransferListStart.
+    uint32_t                      transfer_list_count;         ///< Number of transfers in the transfer list.
+    volatile uint32_t             transfer_list_index;         ///< Index of the transfer that is in progress.
+    i3c_ibi_ring_t              * p_ibi_ring;                  ///< Ring for capturing IBIs set with @ref R_I3C_IbiRingSet.
+    bool                          ibi_ring_discard;            ///< The IBI in progress is discarded because the ring is full.
     i3c_cfg_t const             * p_cfg;                       ///< A pointer to the configuration structure provided during open.
 } i3c_instance_ctrl_t;
 
@@ -271,6 +321,11 @@ fsp_err_t R_I3C_IbiWrite(i3c_ctrl_t * const    p_api_ctrl,
                          uint8_t const * const p_data,
                          uint32_t              length);
 fsp_err_t R_I3C_IbiRead(i3c_ctrl_t * const p_api_ctrl, uint8_t * const p_data, uint32_t length);
+fsp_err_t R_I3C_TransferListStart(i3c_ctrl_t * const                p_api_ctrl,
+                                  i3c_transfer_descriptor_t * const p_transfers,
+                                  uint32_t                          count);
+fsp_err_t R_I3C_IbiRingSet(i3c_ctrl_t * const p_api_ctrl, i3c_ibi_ring_t * const p_ring);
+fsp_err_t R_I3C_IbiRingRead(i3c_ibi_ring_t * const p_ring, i3c_ibi_ring_entry_t * const p_entry);
 fsp_err_t R_I3C_Close(i3c_ctrl_t * const p_api_ctrl);
 
 /*******************************************************************************************************************//**
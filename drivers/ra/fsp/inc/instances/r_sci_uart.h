@@ -231,6 +231,10 @@ fsp_err_t R_SCI_UART_BaudCalculate(uint32_t               baudrate,
                                    bool                   bitrate_modulation,
                                    uint32_t               baud_rate_error_x_1000,
                                    baud_setting_t * const p_baud_setting);
+fsp_err_t R_SCI_UART_BaudTablePrecompute(uint32_t const * const p_baudrates,
+                                         uint32_t               num_baudrates,
+                                         bool                   bitrate_modulation,
+                                         uint32_t               baud_rate_error_x_1000);
 fsp_err_t R_SCI_UART_CallbackSet(uart_ctrl_t * const          p_api_ctrl,
                                  void (                     * p_callback)(uart_callback_args_t *),
                                  void * const                 p_context,
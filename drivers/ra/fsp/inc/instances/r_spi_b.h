@@ -125,6 +125,16 @@ typedef struct st_spi_b_extended_cfg
     spi_b_delay_count_t            next_access_delay;  ///< SPI Next-Access Delay Register Setting
 } spi_b_extended_cfg_t;
 
+/** Transaction executed by @ref R_SPI_B_TransactionQueueStart. */
+typedef struct st_spi_b_transaction
+{
+    spi_b_ssl_select_t ssl_select;     ///< Slave select line asserted during this transaction
+    spi_bit_width_t    bit_width;      ///< Bits per data frame
+    void const       * p_src;          ///< Buffer to transmit, or NULL to transmit zeros
+    void             * p_dest;         ///< Buffer to receive, or NULL to discard received data
+    uint32_t           length;         ///< Number of data frames to transfer
+} spi_b_transaction_t;
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref spi_api_t::open is called. */
 typedef struct st_spi_b_instance_ctrl
 {
@@ -138,6 +148,10 @@ typedef struct st_spi_b_instance_ctrl
     uint32_t          count;           ///< Number of Data Frames to transfer (8-bit, 16-bit, 32-bit)
     spi_bit_width_t   bit_width;       ///< Bits per Data frame (8-bit, 16-bit, 32-bit)
 
+    spi_b_transaction_t const * p_queue;     ///< Transaction queue in progress, or NULL
+    uint32_t                    queue_count; ///< Number of transactions in the queue
+    volatile uint32_t           queue_index; ///< Index of the transaction in progress
+
     /* Pointer to callback and optional working memory */
     void (* p_callback)(spi_callback_args_t *);
     spi_callback_args_t * p_callback_memory;
@@ -177,6 +191,10 @@ fsp_err_t R_SPI_B_WriteRead(spi_ctrl_t * const    p_api_ctrl,
                             uint32_t const        length,
                             spi_bit_width_t const bit_width);
 
+fsp_err_t R_SPI_B_TransactionQueueStart(spi_ctrl_t * const                p_api_ctrl,
+                                        spi_b_transaction_t const * const p_queue,
+                                        uint32_t const                    count);
+
 fsp_err_t R_SPI_B_Close(spi_ctrl_t * const p_api_ctrl);
 
 fsp_err_t R_SPI_B_CalculateBitrate(uint32_t bitrate, spi_b_clock_source_t clock_source, rspck_div_setting_t * spck_div);
@@ -0,0 +1,193 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/*******************************************************************************************************************//**
+ * @addtogroup ADC_PIPELINE
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_ADC_PIPELINE_H
+#define RM_ADC_PIPELINE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "rm_adc_pipeline_cfg.h"
+#include "r_adc_api.h"
+#include "r_elc_api.h"
+#include "r_timer_api.h"
+#include "r_transfer_api.h"
+#if BSP_FEATURE_MACL_SUPPORTED
+ #include "bsp_macl.h"
+#endif
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Read sample n of a channel view. */
+#define ADC_PIPELINE_VIEW_SAMPLE(p_view, n)    ((p_view)->p_data[(uint32_t) (n) * (p_view)->stride])
+
+/* The IIR stage uses the MACL biquad filter, which is only available with the CMSIS-DSP types. */
+#if BSP_FEATURE_MACL_SUPPORTED
+ #if __has_include("arm_math_types.h")
+  #define ADC_PIPELINE_IIR_SUPPORTED           (1)
+ #endif
+#endif
+#ifndef ADC_PIPELINE_IIR_SUPPORTED
+ #define ADC_PIPELINE_IIR_SUPPORTED            (0)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the pipeline callback. Several events can be reported in one callback. */
+typedef enum e_adc_pipeline_event
+{
+    ADC_PIPELINE_EVENT_SEGMENT_COMPLETE = 1U << 0, ///< A segment of scans_per_callback scans is complete
+    ADC_PIPELINE_EVENT_HALF_BUFFER      = 1U << 1, ///< The first half of the sample buffer is complete
+    ADC_PIPELINE_EVENT_FULL_BUFFER      = 1U << 2, ///< The second half of the sample buffer is complete
+} adc_pipeline_event_t;
+
+/** Callback arguments for the pipeline callback. */
+typedef struct st_adc_pipeline_callback_args
+{
+    uint32_t         event;            ///< Bitwise OR of @ref adc_pipeline_event_t
+    uint16_t const * p_samples;        ///< First sample of the completed segment, channels interleaved per scan
+    uint32_t         first_scan;       ///< Index of the first scan of the segment in the sample buffer
+    uint32_t         num_scans;        ///< Number of scans in the segment
+    void const     * p_context;        ///< Placeholder for user data
+} adc_pipeline_callback_args_t;
+
+/** De-interleaved view of one channel in the sample buffer. */
+typedef struct st_adc_pipeline_view
+{
+    uint16_t const * p_data;           ///< First sample of the channel
+    uint32_t         stride;           ///< Distance between consecutive samples of the channel, in samples
+    uint32_t         count;            ///< Number of samples in the view
+} adc_pipeline_view_t;
+
+/** Post-processing stage for one channel. Each stage is optional and the stages run in the order listed. */
+typedef struct st_adc_pipeline_filter_cfg
+{
+    uint32_t channel_index;            ///< Offset of the channel in the scan, see @ref RM_ADC_PIPELINE_ChannelViewGet
+
+    /** Number of input samples summed into one output sample. Set to 1 to disable oversampling. */
+    uint16_t oversample;
+
+    /** Right shift applied to the oversampled sum. The shifted sum of full scale 16-bit samples must fit in int32_t,
+     * and so must the moving average sum of average_length shifted sums. */
+    uint8_t oversample_shift;
+
+    /** Moving average length in samples. Set to 0 or 1 to disable the moving average. */
+    uint16_t  average_length;
+    int32_t * p_average_history;       ///< History buffer of average_length samples, zero initialized
+
+#if ADC_PIPELINE_IIR_SUPPORTED
+
+    /** Biquad cascade run on the MACL. Its state buffer carries the filter history from one segment to the next and
+     *  must be zeroed (arm_biquad_cascade_df1_init_q31) before open. Set to NULL to disable the IIR. */
+    arm_biquad_casd_df1_inst_q31 const * p_iir;
+    uint8_t iir_input_shift;           ///< Left shift that converts a sample to the Q31 input of the IIR
+#endif
+
+    int32_t * p_output;                ///< Circular output buffer
+
+    /** Number of samples in the output buffer. Must hold at least the outputs of one segment, that is
+     * scans_per_callback / oversample rounded up. */
+    uint32_t output_length;
+} adc_pipeline_filter_cfg_t;
+
+/** Running state of a post-processing stage. DO NOT INITIALIZE. Initialized in @ref RM_ADC_PIPELINE_Open. */
+typedef struct st_adc_pipeline_filter_state
+{
+    int64_t           oversample_sum;   ///< Sum of the current oversampling window
+    uint32_t          oversample_count; ///< Number of samples in the current oversampling window
+    int32_t           average_sum;      ///< Sum of the moving average history
+    uint32_t          average_index;    ///< Next position in the moving average history
+    volatile uint32_t output_index;     ///< Next position in the output buffer
+    volatile uint32_t outputs_total;    ///< Number of output samples produced since open
+
+    /* Cost of the stage, in CPU cycles per segment. Requires the DWT cycle counter to be enabled by the application;
+     * stays 0 on devices without one. */
+    volatile uint32_t decimate_cycles_max; ///< Longest oversampling and moving average pass over a segment
+    volatile uint32_t iir_cycles_max;      ///< Longest IIR pass over a segment
+} adc_pipeline_filter_state_t;
+
+/** Sampling pipeline configuration. */
+typedef struct st_adc_pipeline_cfg
+{
+    /** ADC instance. Configure the ADC trigger for the ELC and set scan_end_irq to FSP_INVALID_VECTOR. */
+    adc_instance_t const * p_adc;
+    void const           * p_adc_channel_cfg; ///< Channel configuration passed to @ref adc_api_t::scanCfg
+
+    /** Timer instance that paces the scans. */
+    timer_instance_t const * p_timer;
+
+    /** Transfer instance that moves the results. Set its activation source to the ADC scan end event. */
+    transfer_instance_t const * p_transfer;
+
+    /** ELC instance. The ELC must be opened and enabled by the application. */
+    elc_instance_t const * p_elc;
+    elc_peripheral_t       elc_peripheral; ///< ELC peripheral that starts the ADC scan
+    elc_event_t            elc_event;      ///< Timer event that starts the ADC scan
+
+    uint16_t * p_buffer;               ///< Circular sample buffer of num_scans scans
+
+    /** Number of samples in p_buffer. Each scan takes one sample for every ADC data register from the lowest to the
+     * highest scanned channel. */
+    uint32_t buffer_length;
+    uint32_t num_scans;                ///< Number of scans in the sample buffer
+    uint32_t scans_per_callback;       ///< Scans per callback. Must divide num_scans.
+
+    /** Optional post-processing stages run on each completed segment before the callback. */
+    adc_pipeline_filter_cfg_t const * p_filter_cfg;
+    adc_pipeline_filter_state_t     * p_filter_state; ///< State for each stage in p_filter_cfg
+    uint32_t                          num_filters;    ///< Number of post-processing stages
+
+    void (* p_callback)(adc_pipeline_callback_args_t * p_args); ///< Callback called from the transfer interrupt
+    void const * p_context;                                     ///< Placeholder for user data
+} adc_pipeline_cfg_t;
+
+/** Sampling pipeline control block. DO NOT INITIALIZE. Initialized in @ref RM_ADC_PIPELINE_Open. */
+typedef struct st_adc_pipeline_instance_ctrl
+{
+    uint32_t                   open;               ///< Whether or not the pipeline is open
+    adc_pipeline_cfg_t const * p_cfg;              ///< Pointer to the configuration
+    transfer_info_t            transfer_info;      ///< Transfer settings for one segment
+    void const               * p_adc_data;         ///< First ADC data register of the scan
+    uint32_t                   num_channels;       ///< Number of samples per scan
+    uint32_t                   opened;             ///< Instances opened by the pipeline, closed again on close
+    uint32_t                   segment;            ///< Index of the segment being filled
+    volatile uint32_t          segments_completed; ///< Number of completed segments
+} adc_pipeline_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_Open(adc_pipeline_instance_ctrl_t * const p_ctrl, adc_pipeline_cfg_t const * const p_cfg);
+fsp_err_t RM_ADC_PIPELINE_Start(adc_pipeline_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_ADC_PIPELINE_Stop(adc_pipeline_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_ADC_PIPELINE_ChannelViewGet(adc_pipeline_instance_ctrl_t * const p_ctrl,
+                                         uint32_t                             channel_index,
+                                         uint32_t                             first_scan,
+                                         uint32_t                             num_scans,
+                                         adc_pipeline_view_t * const          p_view);
+fsp_err_t RM_ADC_PIPELINE_Close(adc_pipeline_instance_ctrl_t * const p_ctrl);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_ADC_PIPELINE_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup ADC_PIPELINE)
+ **********************************************************************************************************************/
@@ -0,0 +1,122 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/*******************************************************************************************************************//**
+ * @addtogroup DISPLAY_DIRTY
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_DISPLAY_DIRTY_H
+#define RM_DISPLAY_DIRTY_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "rm_display_dirty_cfg.h"
+#include "r_display_api.h"
+#include "r_mipi_dsi_api.h"
+#include "r_transfer_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Refresh method of the panel. */
+typedef enum e_display_dirty_mode
+{
+    /** Command mode panel with its own frame memory. Only the dirty windows are sent over MIPI DSI. */
+    DISPLAY_DIRTY_MODE_COMMAND = 0,
+
+    /** Video mode panel refreshed by the display controller from two frame buffers. Only the dirty rows are copied
+     *  to the back buffer after a flip. */
+    DISPLAY_DIRTY_MODE_VIDEO = 1,
+} display_dirty_mode_t;
+
+/** Rectangle in pixels. */
+typedef struct st_display_dirty_rect
+{
+    uint16_t x;                        ///< Left column
+    uint16_t y;                        ///< Top row
+    uint16_t width;                    ///< Width in pixels
+    uint16_t height;                   ///< Height in pixels
+} display_dirty_rect_t;
+
+/** Dirty rectangle tracker configuration. */
+typedef struct st_display_dirty_cfg
+{
+    display_dirty_mode_t mode;         ///< Refresh method of the panel
+
+    uint16_t hsize;                    ///< Horizontal size of the frame in pixels
+    uint16_t vsize;                    ///< Vertical size of the frame in pixels
+    uint32_t hstride;                  ///< Size of a frame buffer line in bytes
+    uint8_t  bytes_per_pixel;          ///< Size of a pixel in bytes
+
+    /** Dirty rectangles are widened to multiples of this many pixels. Must be a power of two. Set to 1 to disable. */
+    uint8_t alignment;
+
+    display_dirty_rect_t * p_rects;    ///< Storage for the dirty rectangles of the frame being drawn
+    uint32_t               max_rects;  ///< Number of entries in p_rects
+
+    /** Two rectangles are merged when the merged rectangle covers at most this many pixels more than the two
+     *  rectangles. Larger values send fewer, larger windows. */
+    uint32_t merge_slack;
+
+    /** MIPI DSI instance used in command mode. The instance must be opened and started by the application. */
+    mipi_dsi_instance_t const * p_mipi_dsi;
+    uint8_t                     channel;         ///< Virtual channel of the panel
+    uint8_t                   * p_packet_buffer; ///< Two packet buffers of packet_size bytes each, command mode only
+    uint16_t                    packet_size;     ///< Size of one memory write packet in bytes, DCS command included
+
+    /** Display instance used in video mode. The instance must be opened and started by the application. */
+    display_instance_t const * p_display;
+    display_frame_layer_t      layer;           ///< Layer whose frame buffer is changed
+    display_dirty_rect_t     * p_sync_rects;    ///< Storage for max_rects rectangles to copy, video mode only
+
+    /** Optional transfer instance used to copy dirty rows in video mode. Set its activation source to software
+     *  (ELC_EVENT_NONE). Set to NULL to copy with the CPU. */
+    transfer_instance_t const * p_transfer;
+} display_dirty_cfg_t;
+
+/** Dirty rectangle tracker control block. DO NOT INITIALIZE. Initialized in @ref RM_DISPLAY_DIRTY_Open. */
+typedef struct st_display_dirty_instance_ctrl
+{
+    uint32_t                    open;             ///< Whether or not the tracker is open
+    display_dirty_cfg_t const * p_cfg;            ///< Pointer to the configuration
+    uint32_t                    num_rects;        ///< Number of dirty rectangles in the frame being drawn
+    uint32_t                    num_sync_rects;   ///< Number of rectangles still to be copied to the back buffer
+    uint8_t const             * p_sync_src;       ///< Frame buffer the rectangles are copied from
+    uint32_t                    packet_index;     ///< Packet buffer filled next
+    uint8_t                     window[2][5];     ///< Column and page address set payloads
+    transfer_info_t             transfer_info;    ///< Transfer settings for one copy
+    uint32_t                    transfer_max;     ///< Maximum number of transfers in one copy
+} display_dirty_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_Open(display_dirty_instance_ctrl_t * const p_ctrl, display_dirty_cfg_t const * const p_cfg);
+fsp_err_t RM_DISPLAY_DIRTY_RectAdd(display_dirty_instance_ctrl_t * const p_ctrl,
+                                   display_dirty_rect_t const * const    p_rect);
+fsp_err_t RM_DISPLAY_DIRTY_Flush(display_dirty_instance_ctrl_t * const p_ctrl, uint8_t * const p_frame);
+fsp_err_t RM_DISPLAY_DIRTY_BufferSync(display_dirty_instance_ctrl_t * const p_ctrl, uint8_t * const p_frame);
+fsp_err_t RM_DISPLAY_DIRTY_Close(display_dirty_instance_ctrl_t * const p_ctrl);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup DISPLAY_DIRTY)
+ **********************************************************************************************************************/
@@ -170,6 +170,10 @@ void R_BSP_MaclMatScaleQ31 (const arm_matrix_instance_q31 * p_src,
 /*******************************************************************************************************************//**
  * Perform the biquad cascade direct form I filter in Q31 via MACL module
  *
+ * The x[n-1], x[n-2], y[n-1] and y[n-2] terms of every sample are taken from the state buffer, so a stream can be
+ * filtered in consecutive blocks with the same result as one call. The state buffer must be zeroed before the first
+ * call, as arm_biquad_cascade_df1_init_q31 does.
+ *
  * @param[in]   p_biquad_csd_df1_inst   Point to instance of the Q31 Biquad cascade structure
  * @param[in]   p_src                   Point to input sample to be filtered.
  * @param[out]  p_dst                   Point to buffer for storing filtered sample.
@@ -188,7 +192,6 @@ void R_BSP_MaclBiquadCsdDf1Q31 (const arm_biquad_casd_df1_inst_q31 * p_biquad_cs
     uint32_t            sample;                                                               // Loop counter
     uint32_t            state_update_element;                                                 // Update state buffer
     uint32_t            src_ctrl;                                                             // Control the value of source
-    uint32_t            sample_ctrl;                                                          // Control the value of sample
     uint32_t            coeffs_ctrl;                                                          // Control the value of coefficient
     uint32_t            shift           = ((uint32_t) p_biquad_csd_df1_inst->postShift + 1U); // Shift to be applied to the output
     uint32_t            r_shift         = BSP_MACL_32_BIT - shift;                            // Shift to be applied to the output
@@ -202,9 +205,8 @@ void R_BSP_MaclBiquadCsdDf1Q31 (const arm_biquad_casd_df1_inst_q31 * p_biquad_cs
 
     while (stage > 0U)
     {
-        sample      = block_size;
-        src_ctrl    = 0U;
-        sample_ctrl = 0U;
+        sample   = block_size;
+        src_ctrl = 0U;
 
         /**
          * y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n -2] + a1 * y[n - 1] + a2 * y[n - 2]
@@ -219,33 +221,25 @@ void R_BSP_MaclBiquadCsdDf1Q31 (const arm_biquad_casd_df1_inst_q31 * p_biquad_cs
             R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl];
             r_macl_wait_operation();
 
-            /* Calculate for b1.x[n-1] and a1.y[n-1] */
-            if (sample_ctrl >= 1U)
-            {
-                /* b1 * x[n - 1] */
-                R_MACL->MAC32S = (uint32_t) p_state[state_update_element];
-                R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 1U];
-                r_macl_wait_operation();
+            /* b1 * x[n - 1] */
+            R_MACL->MAC32S = (uint32_t) p_state[state_update_element];
+            R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 1U];
+            r_macl_wait_operation();
 
-                /* a1 * y[n - 1] */
-                R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 2U];
-                R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 3U];
-                r_macl_wait_operation();
-            }
+            /* a1 * y[n - 1] */
+            R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 2U];
+            R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 3U];
+            r_macl_wait_operation();
 
-            /* Calculate for b2 * x[n - 2] and a2 * y[n - 2]*/
-            if (sample_ctrl >= 2U)
-            {
-                /* b2 * x[n - 2] */
-                R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 1U];
-                R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 2U];
-                r_macl_wait_operation();
+            /* b2 * x[n - 2] */
+            R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 1U];
+            R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 2U];
+            r_macl_wait_operation();
 
-                /* a2 * y[n - 2] */
-                R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 3U];
-                R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 4U];
-                r_macl_wait_operation();
-            }
+            /* a2 * y[n - 2] */
+            R_MACL->MAC32S = (uint32_t) p_state[state_update_element + 3U];
+            R_MACL->MULB0  = (uint32_t) p_coeffs[coeffs_ctrl + 4U];
+            r_macl_wait_operation();
 
             /* Update state buffer */
             p_state[state_update_element + 1U] = p_state[state_update_element]; // x[n - 2] = x[n - 1]
@@ -260,7 +254,6 @@ void R_BSP_MaclBiquadCsdDf1Q31 (const arm_biquad_casd_df1_inst_q31 * p_biquad_cs
 
             sample--;
             src_ctrl++;
-            sample_ctrl++;
 
             /* Check before update addr of p_dst to prevent segmentation fault */
             if (sample != 0U)
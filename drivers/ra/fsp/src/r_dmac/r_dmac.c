@@ -17,6 +17,9 @@
 /** Driver ID (DMAC in ASCII) */
 #define DMAC_ID                         (0x444d4143)
 
+/** "DMPL" in ASCII, used to determine if the channel pool is open. */
+#define DMAC_POOL_ID                    (0x444d504c)
+
 /** Length limited to 1024 transfers for repeat and block mode */
 #define DMAC_REPEAT_BLOCK_MAX_LENGTH    (0x400)
 
@@ -95,6 +98,13 @@ typedef struct st_dmac_callback
     void * p_context;
 } dmac_callback_t;
 
+/* Requests completed inside a pool critical section. Their callbacks are called after the critical section is left. */
+typedef struct st_dmac_pool_done
+{
+    dmac_pool_request_t * p_head;
+    dmac_pool_request_t * p_tail;
+} dmac_pool_done_t;
+
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
@@ -104,6 +114,16 @@ static fsp_err_t r_dmac_prv_enable(dmac_instance_ctrl_t * p_ctrl);
 static void      r_dmac_prv_disable(dmac_instance_ctrl_t * p_ctrl);
 static void      r_dmac_config_transfer_info(dmac_instance_ctrl_t * p_ctrl, transfer_info_t * p_info);
 
+static void                  r_dmac_pool_callback(dmac_callback_args_t * p_args);
+static void                  r_dmac_pool_run(dmac_pool_channel_t * p_channel,
+                                             dmac_pool_request_t * p_request,
+                                             dmac_pool_done_t    * p_done);
+static dmac_pool_request_t * r_dmac_pool_complete(dmac_pool_channel_t * p_channel,
+                                                  dmac_pool_request_t * p_request,
+                                                  dmac_pool_done_t    * p_done);
+static void                  r_dmac_pool_done_add(dmac_pool_done_t * p_done, dmac_pool_request_t * p_request);
+static void                  r_dmac_pool_done_notify(dmac_pool_done_t * p_done);
+
 #if DMAC_CFG_PARAM_CHECKING_ENABLE
 static fsp_err_t r_dma_open_parameter_checking(dmac_instance_ctrl_t * const p_ctrl, transfer_cfg_t const * const p_cfg);
 static fsp_err_t r_dmac_reconfigure_parameter_checking(transfer_info_t const * const p_info);
@@ -115,6 +135,9 @@ static fsp_err_t r_dmac_enable_parameter_checking(dmac_instance_ctrl_t * const p
  * Private global variables
  **********************************************************************************************************************/
 
+/* Transfer info written to pool channels while they are idle. */
+static transfer_info_t g_dmac_pool_idle_info;
+
 /***********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -475,6 +498,215 @@ fsp_err_t R_DMAC_Close (transfer_ctrl_t * const p_api_ctrl)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Open a pool of DMAC channels that are assigned to requests on demand. The channels in the pool are opened by this
+ * function and must not be used through any other transfer instance.
+ *
+ * Set dmac_pool_channel_t::extend channel, irq and ipl for each channel before calling this function. The pool uses
+ * the transfer end interrupt of each channel to complete requests, so irq must be valid.
+ *
+ * Only transfers submitted through @ref R_DMAC_PoolSubmit share the pool channels. Drivers that take a
+ * transfer_instance_t, such as r_sci_uart, r_spi, r_ssi and r_sdhi, still need a channel of their own outside the
+ * pool.
+ *
+ * @retval FSP_SUCCESS                    Pool opened successfully. All channels are free.
+ * @retval FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN           The pool is already open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls: @ref transfer_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_PoolOpen (dmac_pool_ctrl_t * const p_pool, dmac_pool_channel_t * const p_channels, uint8_t num_channels)
+{
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pool);
+    FSP_ERROR_RETURN(DMAC_POOL_ID != p_pool->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ASSERT(NULL != p_channels);
+    FSP_ASSERT(0U != num_channels);
+#endif
+
+    p_pool->p_channels      = p_channels;
+    p_pool->num_channels    = num_channels;
+    p_pool->p_queue_head    = NULL;
+    p_pool->queue_depth     = 0U;
+    p_pool->queue_depth_max = 0U;
+
+    for (uint8_t i = 0U; i < num_channels; i++)
+    {
+        dmac_pool_channel_t * p_channel = &p_channels[i];
+
+        p_channel->extend.offset            = 0;
+        p_channel->extend.src_buffer_size   = 0U;
+        p_channel->extend.activation_source = ELC_EVENT_NONE;
+        p_channel->extend.p_callback        = r_dmac_pool_callback;
+        p_channel->extend.p_callback_memory = NULL;
+        p_channel->extend.p_context         = p_channel;
+
+        p_channel->cfg.p_info   = &g_dmac_pool_idle_info;
+        p_channel->cfg.p_extend = &p_channel->extend;
+
+        p_channel->p_pool             = p_pool;
+        p_channel->p_active           = NULL;
+        p_channel->requests_completed = 0U;
+        p_channel->requests_chained   = 0U;
+
+        fsp_err_t err = R_DMAC_Open(&p_channel->ctrl, &p_channel->cfg);
+        if (FSP_SUCCESS != err)
+        {
+            /* Close the channels that were already opened. */
+            while (i > 0U)
+            {
+                i--;
+                R_DMAC_Close(&p_channels[i].ctrl);
+            }
+
+            return err;
+        }
+    }
+
+    p_pool->open = DMAC_POOL_ID;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Submit a request to the channel pool. The request starts immediately on a free channel. If all channels are busy,
+ * the request is queued by priority and started from the DMAC interrupt when a channel becomes free. Requests of the
+ * same priority are started in submission order.
+ *
+ * Follow-on requests linked through dmac_pool_request_t::p_next run on the same channel without returning to the
+ * queue. If a request cannot be started, dmac_pool_request_t::err is set, its callback is called and its follow-on
+ * requests are skipped.
+ *
+ * The request and its transfer info must remain valid, and the request must not be submitted again, until its callback
+ * is called.
+ *
+ * @retval FSP_SUCCESS              Request started or queued.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pool is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_PoolSubmit (dmac_pool_ctrl_t * const p_pool, dmac_pool_request_t * const p_request)
+{
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pool);
+    FSP_ERROR_RETURN(DMAC_POOL_ID == p_pool->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_request);
+
+    for (dmac_pool_request_t const * p_check = p_request; NULL != p_check; p_check = p_check->p_next)
+    {
+        fsp_err_t err = r_dmac_reconfigure_parameter_checking(p_check->p_info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        FSP_ASSERT(TRANSFER_IRQ_END == p_check->p_info->transfer_settings_word_b.irq);
+    }
+#endif
+
+    p_request->p_queue_next = NULL;
+
+    dmac_pool_done_t done = {NULL, NULL};
+
+    /* The queue and the channel state are also updated from the DMAC interrupts. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    dmac_pool_channel_t * p_channel = NULL;
+    for (uint8_t i = 0U; i < p_pool->num_channels; i++)
+    {
+        if (NULL == p_pool->p_channels[i].p_active)
+        {
+            p_channel = &p_pool->p_channels[i];
+            break;
+        }
+    }
+
+    if (NULL != p_channel)
+    {
+        r_dmac_pool_run(p_channel, p_request, &done);
+    }
+    else
+    {
+        /* Insert the request after all pending requests with the same or higher priority. */
+        dmac_pool_request_t ** pp_link = &p_pool->p_queue_head;
+        while ((NULL != *pp_link) && ((*pp_link)->priority <= p_request->priority))
+        {
+            pp_link = &(*pp_link)->p_queue_next;
+        }
+
+        p_request->p_queue_next = *pp_link;
+        *pp_link                = p_request;
+
+        p_pool->queue_depth++;
+        if (p_pool->queue_depth > p_pool->queue_depth_max)
+        {
+            p_pool->queue_depth_max = p_pool->queue_depth;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Report requests that could not be started. */
+    r_dmac_pool_done_notify(&done);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Close all channels of the pool. Requests in progress and pending requests are stopped: their
+ * dmac_pool_request_t::err is set to FSP_ERR_ABORTED and their callbacks are called before this function returns.
+ * Follow-on requests of a stopped request are skipped.
+ *
+ * @retval FSP_SUCCESS              Pool closed.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pool is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_DMAC_PoolClose (dmac_pool_ctrl_t * const p_pool)
+{
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pool);
+    FSP_ERROR_RETURN(DMAC_POOL_ID == p_pool->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    dmac_pool_done_t done = {NULL, NULL};
+
+    /* Prevent the DMAC interrupts from starting queued requests while the channels are closed. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint8_t i = 0U; i < p_pool->num_channels; i++)
+    {
+        dmac_pool_channel_t * p_channel = &p_pool->p_channels[i];
+
+        R_DMAC_Close(&p_channel->ctrl);
+
+        if (NULL != p_channel->p_active)
+        {
+            p_channel->p_active->err = FSP_ERR_ABORTED;
+            r_dmac_pool_done_add(&done, p_channel->p_active);
+            p_channel->p_active = NULL;
+        }
+    }
+
+    dmac_pool_request_t * p_request = p_pool->p_queue_head;
+    while (NULL != p_request)
+    {
+        dmac_pool_request_t * p_next = p_request->p_queue_next;
+
+        p_request->err = FSP_ERR_ABORTED;
+        r_dmac_pool_done_add(&done, p_request);
+
+        p_request = p_next;
+    }
+
+    p_pool->p_queue_head = NULL;
+    p_pool->queue_depth  = 0U;
+    p_pool->open         = 0U;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Report the stopped requests. The pool is closed, so the callbacks must not submit them again. */
+    r_dmac_pool_done_notify(&done);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup DMAC)
  **********************************************************************************************************************/
@@ -534,6 +766,156 @@ static void r_dmac_prv_disable (dmac_instance_ctrl_t * p_ctrl)
     p_ctrl->p_reg->DMREQ = 0;
 }
 
+/*******************************************************************************************************************//**
+ * Start requests on a pool channel until one is started successfully or no request is left. Must be called with
+ * interrupts disabled.
+ *
+ * @param[in]   p_channel      Pool channel to use.
+ * @param[in]   p_request      First request to start, or NULL to free the channel.
+ * @param[out]  p_done         Requests that could not be started are added to this list.
+ **********************************************************************************************************************/
+static void r_dmac_pool_run (dmac_pool_channel_t * p_channel,
+                             dmac_pool_request_t * p_request,
+                             dmac_pool_done_t    * p_done)
+{
+    while (NULL != p_request)
+    {
+        p_channel->p_active                 = p_request;
+        p_channel->extend.activation_source = p_request->activation_source;
+
+        p_request->err = R_DMAC_Reconfigure(&p_channel->ctrl, p_request->p_info);
+
+        if ((FSP_SUCCESS == p_request->err) && (ELC_EVENT_NONE == p_request->activation_source))
+        {
+            p_request->err = R_DMAC_SoftwareStart(&p_channel->ctrl, TRANSFER_START_MODE_REPEAT);
+        }
+
+        if (FSP_SUCCESS == p_request->err)
+        {
+            return;
+        }
+
+        /* The request could not be started. Complete it with the error and continue with the next request. */
+        p_request = r_dmac_pool_complete(p_channel, p_request, p_done);
+    }
+
+    p_channel->p_active = NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Complete a request on a pool channel and select the next request for the channel. Must be called with interrupts
+ * disabled. The callback of the request is not called here; call r_dmac_pool_done_notify after interrupts are enabled.
+ *
+ * @param[in]   p_channel      Pool channel the request ran on.
+ * @param[in]   p_request      Completed request.
+ * @param[out]  p_done         The completed request is added to this list.
+ *
+ * @return The follow-on request, the highest priority pending request, or NULL if there is nothing left to run.
+ **********************************************************************************************************************/
+static dmac_pool_request_t * r_dmac_pool_complete (dmac_pool_channel_t * p_channel,
+                                                   dmac_pool_request_t * p_request,
+                                                   dmac_pool_done_t    * p_done)
+{
+    dmac_pool_ctrl_t    * p_pool = p_channel->p_pool;
+    dmac_pool_request_t * p_next = NULL;
+
+    p_channel->requests_completed++;
+
+    r_dmac_pool_done_add(p_done, p_request);
+
+    if ((FSP_SUCCESS == p_request->err) && (NULL != p_request->p_next))
+    {
+        /* Chain the follow-on request on the same channel. */
+        p_next = p_request->p_next;
+        p_channel->requests_chained++;
+    }
+    else if (NULL != p_pool->p_queue_head)
+    {
+        p_next               = p_pool->p_queue_head;
+        p_pool->p_queue_head = p_next->p_queue_next;
+        p_pool->queue_depth--;
+    }
+    else
+    {
+        /* Nothing left to run. */
+    }
+
+    return p_next;
+}
+
+/*******************************************************************************************************************//**
+ * Transfer end callback of pool channels. Completes the active request and starts the next one.
+ *
+ * @param[in]   p_args         Callback arguments. p_context points to the pool channel.
+ **********************************************************************************************************************/
+static void r_dmac_pool_callback (dmac_callback_args_t * p_args)
+{
+    dmac_pool_channel_t * p_channel = (dmac_pool_channel_t *) p_args->p_context;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    dmac_pool_done_t done = {NULL, NULL};
+
+    FSP_CRITICAL_SECTION_ENTER;
+
+    dmac_pool_request_t * p_request = p_channel->p_active;
+    if (NULL != p_request)
+    {
+        r_dmac_pool_run(p_channel, r_dmac_pool_complete(p_channel, p_request, &done), &done);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    r_dmac_pool_done_notify(&done);
+}
+
+/*******************************************************************************************************************//**
+ * Add a request to a list of completed requests. The request is no longer queued, so its queue link is free to hold
+ * the list.
+ *
+ * @param[in,out] p_done       Completed requests.
+ * @param[in]     p_request    Request to add at the end of the list.
+ **********************************************************************************************************************/
+static void r_dmac_pool_done_add (dmac_pool_done_t * p_done, dmac_pool_request_t * p_request)
+{
+    p_request->p_queue_next = NULL;
+    if (NULL == p_done->p_tail)
+    {
+        p_done->p_head = p_request;
+    }
+    else
+    {
+        p_done->p_tail->p_queue_next = p_request;
+    }
+
+    p_done->p_tail = p_request;
+}
+
+/*******************************************************************************************************************//**
+ * Call the callbacks of completed pool requests, oldest first. Must be called with interrupts enabled so that the
+ * callbacks do not run inside the pool critical section.
+ *
+ * @param[in]   p_done         Completed requests.
+ **********************************************************************************************************************/
+static void r_dmac_pool_done_notify (dmac_pool_done_t * p_done)
+{
+    while (NULL != p_done->p_head)
+    {
+        /* Detach the request before its callback, which may submit it again and reuse its queue link. */
+        dmac_pool_request_t * p_request = p_done->p_head;
+        p_done->p_head          = p_request->p_queue_next;
+        p_request->p_queue_next = NULL;
+
+        if (NULL != p_request->p_callback)
+        {
+            dmac_callback_args_t args;
+            args.p_context = p_request->p_context;
+            p_request->p_callback(&args);
+        }
+    }
+
+    p_done->p_tail = NULL;
+}
+
 /*******************************************************************************************************************//**
  * Write the transfer info to the hardware registers.
  *
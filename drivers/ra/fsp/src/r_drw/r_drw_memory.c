@@ -15,16 +15,69 @@
 #include <stdlib.h>
 #include <string.h>
 #include "r_drw_base.h"
+#include "r_drw_memory.h"
 #include "r_drw_cfg.h"
 
 #if (BSP_CFG_RTOS == 2)                // FreeRTOS
  #include "FreeRTOS.h"
 #endif
 
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Round a size up to the video memory pool alignment. */
+#define DRW_PRV_VIDMEM_ALIGN(x)    (((x) + (DRW_VIDMEM_ALIGNMENT - 1U)) & ~(DRW_VIDMEM_ALIGNMENT - 1U))
+
+/* Largest size that can be rounded up with DRW_PRV_VIDMEM_ALIGN without wrapping. */
+#define DRW_PRV_VIDMEM_SIZE_MAX    (UINT32_MAX - (DRW_VIDMEM_ALIGNMENT - 1U))
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Bump allocator over one memory region. */
+typedef struct st_drw_prv_arena
+{
+    uint8_t * p_base;                  /* Start of the region */
+    uint32_t  size;                    /* Size of the region in bytes */
+    uint32_t  offset;                  /* Next free byte */
+    uint32_t  peak;                    /* Highest offset reached */
+    uint32_t  live;                    /* Number of allocations that have not been freed */
+} drw_prv_arena_t;
+
+/* Video memory pool state. */
+typedef struct st_drw_prv_vidmem
+{
+    bool            initialized;       /* Set by R_DRW_VidmemPoolInit */
+    uint8_t       * p_slab_base;       /* First display list slab */
+    uint8_t       * p_slab_end;        /* End of the display list slabs */
+    uint32_t        slab_size;         /* Size of one display list slab */
+    void          * p_slab_free;       /* Free list of display list slabs */
+    uint32_t        slabs_used;        /* Display list slabs currently allocated */
+    uint32_t        slabs_peak;        /* Highest number of display list slabs allocated */
+    drw_prv_arena_t texture;           /* Texture region */
+    drw_prv_arena_t frame;             /* Per-frame arena */
+    uint32_t        heap_allocs;       /* Video memory allocations served by the heap */
+    uint32_t        heap_frees;        /* Video memory blocks returned to the heap */
+} drw_prv_vidmem_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void   r_drw_arena_init(drw_prv_arena_t * p_arena, void * p_base, uint32_t size);
+static void * r_drw_arena_alloc(drw_prv_arena_t * p_arena, uint32_t size);
+static bool   r_drw_arena_contains(drw_prv_arena_t const * p_arena, void const * ptr);
+static void * r_drw_vidmem_pool_alloc(d1_int_t memtype, d1_uint_t size);
+static bool   r_drw_vidmem_pool_free(void * ptr);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
 
+/* Video memory pool. The pool is not used until R_DRW_VidmemPoolInit is called. */
+static drw_prv_vidmem_t g_drw_vidmem;
+
 /***********************************************************************************************************************
  * Extern functions
  **********************************************************************************************************************/
@@ -122,10 +175,13 @@ d1_uint_t d1_memsize (void * ptr)
 
 /*******************************************************************************************************************//**
  * Allocate video memory.
- * FSP does not use virtual memory so this function simply calls d1_allocmem.
+ * FSP does not use virtual memory. If the video memory pool is initialized, display list blocks are taken from the
+ * display list slabs and textures from the texture region. Other allocations, and allocations that do not fit in the
+ * pool, are served by d1_allocmem.
  *
  * @param[in] handle    Pointer to the d1_device object (not used).
- * @param[in] memtype   Type of memory (not used).
+ * @param[in] memtype   Type of memory. d1_mem_dlist and d1_mem_texture are served by the pool if it is initialized;
+ *                      other types always come from d1_allocmem.
  * @param[in] size      Number of bytes to allocate.
  * @retval    Non-NULL  The function returns a pointer to the allocation if successful.
  * @retval    NULL      The function returns Null if memory allocation failed.
@@ -133,17 +189,30 @@ d1_uint_t d1_memsize (void * ptr)
 void * d1_allocvidmem (d1_device * handle, d1_int_t memtype, d1_uint_t size)
 {
     FSP_PARAMETER_NOT_USED(handle);
-    FSP_PARAMETER_NOT_USED(memtype);
 
-    return d1_allocmem(size);
+    void * p_mem = r_drw_vidmem_pool_alloc(memtype, size);
+
+    if (NULL == p_mem)
+    {
+        p_mem = d1_allocmem(size);
+        if (NULL != p_mem)
+        {
+            FSP_CRITICAL_SECTION_DEFINE;
+            FSP_CRITICAL_SECTION_ENTER;
+            g_drw_vidmem.heap_allocs++;
+            FSP_CRITICAL_SECTION_EXIT;
+        }
+    }
+
+    return p_mem;
 }
 
 /*******************************************************************************************************************//**
  * Free video memory.
- * FSP does not use virtual memory so this function simply calls d1_freemem.
+ * Blocks from the video memory pool are returned to the pool. Other blocks are freed with d1_freemem.
  *
  * @param[in] handle    Pointer to the d1_device object (not used).
- * @param[in] memtype   Type of memory (not used).
+ * @param[in] memtype   Type of memory (not used; the owner of the block is found from its address).
  * @param[in] ptr       Address returned by d1_allocvidmem.
  **********************************************************************************************************************/
 void d1_freevidmem (d1_device * handle, d1_int_t memtype, void * ptr)
@@ -151,7 +220,15 @@ void d1_freevidmem (d1_device * handle, d1_int_t memtype, void * ptr)
     FSP_PARAMETER_NOT_USED(handle);
     FSP_PARAMETER_NOT_USED(memtype);
 
-    d1_freemem(ptr);
+    if ((NULL != ptr) && !r_drw_vidmem_pool_free(ptr))
+    {
+        d1_freemem(ptr);
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        g_drw_vidmem.heap_frees++;
+        FSP_CRITICAL_SECTION_EXIT;
+    }
 }
 
 /*******************************************************************************************************************//**
@@ -328,6 +405,276 @@ d1_int_t d1_cacheblockflush (d1_device * handle, d1_int_t memtype, const void *
     return 1;
 }
 
+/*******************************************************************************************************************//**
+ * Initialize the video memory pool. Call this function before d2_inithw so that all display list blocks are taken
+ * from the pool. The display list slab size should be the display list block size in bytes; blocks that do not fit in
+ * a slab fall back to the heap and are counted in drw_vidmem_stats_t::heap_allocs.
+ *
+ * @param[in] p_cfg     Pool configuration.
+ * @retval    FSP_SUCCESS               The pool is initialized.
+ * @retval    FSP_ERR_ASSERTION         p_cfg is NULL.
+ * @retval    FSP_ERR_INVALID_ALIGNMENT A region is not aligned to DRW_VIDMEM_ALIGNMENT.
+ * @retval    FSP_ERR_INVALID_SIZE      The display list slab size cannot be rounded up to DRW_VIDMEM_ALIGNMENT.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_VidmemPoolInit (drw_vidmem_cfg_t const * const p_cfg)
+{
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_dlist_slabs & (DRW_VIDMEM_ALIGNMENT - 1U)), FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_texture_region & (DRW_VIDMEM_ALIGNMENT - 1U)),
+                     FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_frame_arena & (DRW_VIDMEM_ALIGNMENT - 1U)), FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(p_cfg->dlist_slab_size <= DRW_PRV_VIDMEM_SIZE_MAX, FSP_ERR_INVALID_SIZE);
+
+    uint32_t slab_size = DRW_PRV_VIDMEM_ALIGN(p_cfg->dlist_slab_size);
+    if (slab_size < sizeof(void *))
+    {
+        slab_size = DRW_VIDMEM_ALIGNMENT;
+    }
+
+    uint32_t slab_count = (NULL != p_cfg->p_dlist_slabs) ? p_cfg->dlist_slab_count : 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Link all display list slabs into the free list. */
+    g_drw_vidmem.p_slab_base = (uint8_t *) p_cfg->p_dlist_slabs;
+    g_drw_vidmem.p_slab_end  = g_drw_vidmem.p_slab_base + (slab_count * slab_size);
+    g_drw_vidmem.slab_size   = slab_size;
+    g_drw_vidmem.p_slab_free = NULL;
+    for (uint32_t i = slab_count; i > 0U; i--)
+    {
+        void ** p_slab = (void **) (g_drw_vidmem.p_slab_base + ((i - 1U) * slab_size));
+        *p_slab                  = g_drw_vidmem.p_slab_free;
+        g_drw_vidmem.p_slab_free = p_slab;
+    }
+
+    g_drw_vidmem.slabs_used = 0U;
+    g_drw_vidmem.slabs_peak = 0U;
+
+    r_drw_arena_init(&g_drw_vidmem.texture, p_cfg->p_texture_region, p_cfg->texture_region_size);
+    r_drw_arena_init(&g_drw_vidmem.frame, p_cfg->p_frame_arena, p_cfg->frame_arena_size);
+
+    g_drw_vidmem.heap_allocs = 0U;
+    g_drw_vidmem.heap_frees  = 0U;
+    g_drw_vidmem.initialized = true;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Allocate memory from the frame arena. The memory is valid until the next call to R_DRW_VidmemFrameReset.
+ *
+ * @param[in] size      Number of bytes to allocate.
+ * @retval    Non-NULL  Pointer to the allocation.
+ * @retval    NULL      The frame arena is not configured or is full.
+ **********************************************************************************************************************/
+void * R_DRW_VidmemFrameAlloc (uint32_t size)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    void * p_mem = r_drw_arena_alloc(&g_drw_vidmem.frame, size);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return p_mem;
+}
+
+/*******************************************************************************************************************//**
+ * Release all allocations of the frame arena. Call this function once per frame after the GPU has finished using the
+ * frame's allocations.
+ **********************************************************************************************************************/
+void R_DRW_VidmemFrameReset (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    g_drw_vidmem.frame.offset = 0U;
+    g_drw_vidmem.frame.live   = 0U;
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Get the video memory pool statistics. Once rendering reaches a steady state, heap_allocs should no longer increase.
+ *
+ * @param[out] p_stats  Current statistics.
+ * @retval     FSP_SUCCESS          Statistics copied to p_stats.
+ * @retval     FSP_ERR_ASSERTION    p_stats is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_VidmemStatsGet (drw_vidmem_stats_t * const p_stats)
+{
+    FSP_ASSERT(NULL != p_stats);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_stats->dlist_slabs_used   = g_drw_vidmem.slabs_used;
+    p_stats->dlist_slabs_peak   = g_drw_vidmem.slabs_peak;
+    p_stats->texture_bytes_used = g_drw_vidmem.texture.offset;
+    p_stats->texture_bytes_peak = g_drw_vidmem.texture.peak;
+    p_stats->frame_bytes_used   = g_drw_vidmem.frame.offset;
+    p_stats->frame_bytes_peak   = g_drw_vidmem.frame.peak;
+    p_stats->heap_allocs        = g_drw_vidmem.heap_allocs;
+    p_stats->heap_frees         = g_drw_vidmem.heap_frees;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Initialize a bump allocator over a memory region.
+ *
+ * @param[in] p_arena   Arena to initialize.
+ * @param[in] p_base    Start of the region, or NULL if the region is not used.
+ * @param[in] size      Size of the region in bytes.
+ **********************************************************************************************************************/
+static void r_drw_arena_init (drw_prv_arena_t * p_arena, void * p_base, uint32_t size)
+{
+    p_arena->p_base = (uint8_t *) p_base;
+    p_arena->size   = (NULL != p_base) ? size : 0U;
+    p_arena->offset = 0U;
+    p_arena->peak   = 0U;
+    p_arena->live   = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Allocate from a bump allocator. Must be called with interrupts disabled.
+ *
+ * @param[in] p_arena   Arena to allocate from.
+ * @param[in] size      Number of bytes to allocate.
+ * @retval    Non-NULL  Pointer to the allocation.
+ * @retval    NULL      The arena does not have enough space left.
+ **********************************************************************************************************************/
+static void * r_drw_arena_alloc (drw_prv_arena_t * p_arena, uint32_t size)
+{
+    uint32_t aligned = DRW_PRV_VIDMEM_ALIGN(size);
+    void   * p_mem   = NULL;
+
+    /* Sizes above DRW_PRV_VIDMEM_SIZE_MAX wrap to 0 when rounded up, so they are rejected before aligned is used. */
+    if ((0U != size) && (size <= DRW_PRV_VIDMEM_SIZE_MAX) && (aligned <= (p_arena->size - p_arena->offset)))
+    {
+        p_mem            = p_arena->p_base + p_arena->offset;
+        p_arena->offset += aligned;
+        p_arena->live++;
+
+        if (p_arena->offset > p_arena->peak)
+        {
+            p_arena->peak = p_arena->offset;
+        }
+    }
+
+    return p_mem;
+}
+
+/*******************************************************************************************************************//**
+ * Check if a pointer belongs to a bump allocator region.
+ *
+ * @param[in] p_arena   Arena to check.
+ * @param[in] ptr       Pointer to check.
+ * @retval    true      ptr is inside the region.
+ * @retval    false     ptr is outside the region.
+ **********************************************************************************************************************/
+static bool r_drw_arena_contains (drw_prv_arena_t const * p_arena, void const * ptr)
+{
+    uint8_t const * p_byte = (uint8_t const *) ptr;
+
+    return (p_byte >= p_arena->p_base) && (p_byte < (p_arena->p_base + p_arena->size));
+}
+
+/*******************************************************************************************************************//**
+ * Allocate video memory from the pool.
+ *
+ * @param[in] memtype   Type of memory. The d1 memory types are bit flags and can be ORed together; a request that
+ *                      includes d1_mem_dlist is tried on the display list slabs first, then one that includes
+ *                      d1_mem_texture on the texture region.
+ * @param[in] size      Number of bytes to allocate.
+ * @retval    Non-NULL  Pointer to the allocation.
+ * @retval    NULL      The pool is not initialized, the memory type is not pooled or the pool is exhausted.
+ **********************************************************************************************************************/
+static void * r_drw_vidmem_pool_alloc (d1_int_t memtype, d1_uint_t size)
+{
+    void * p_mem = NULL;
+
+    if (g_drw_vidmem.initialized)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        if ((0 != (memtype & d1_mem_dlist)) && (size <= g_drw_vidmem.slab_size) && (NULL != g_drw_vidmem.p_slab_free))
+        {
+            /* Pop a slab from the free list. */
+            p_mem                    = g_drw_vidmem.p_slab_free;
+            g_drw_vidmem.p_slab_free = *(void **) p_mem;
+            g_drw_vidmem.slabs_used++;
+
+            if (g_drw_vidmem.slabs_used > g_drw_vidmem.slabs_peak)
+            {
+                g_drw_vidmem.slabs_peak = g_drw_vidmem.slabs_used;
+            }
+        }
+        else if (0 != (memtype & d1_mem_texture))
+        {
+            p_mem = r_drw_arena_alloc(&g_drw_vidmem.texture, (uint32_t) size);
+        }
+        else
+        {
+            /* Not pooled. */
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+    return p_mem;
+}
+
+/*******************************************************************************************************************//**
+ * Return video memory to the pool. Texture region space is reclaimed when all textures have been freed.
+ *
+ * @param[in] ptr       Pointer to the memory to free.
+ * @retval    true      ptr belonged to the pool and was released.
+ * @retval    false     ptr does not belong to the pool.
+ **********************************************************************************************************************/
+static bool r_drw_vidmem_pool_free (void * ptr)
+{
+    bool      pooled = true;
+    uint8_t * p_byte = (uint8_t *) ptr;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((p_byte >= g_drw_vidmem.p_slab_base) && (p_byte < g_drw_vidmem.p_slab_end))
+    {
+        /* Push the slab back on the free list. */
+        *(void **) ptr           = g_drw_vidmem.p_slab_free;
+        g_drw_vidmem.p_slab_free = ptr;
+        g_drw_vidmem.slabs_used--;
+    }
+    else if (r_drw_arena_contains(&g_drw_vidmem.texture, ptr))
+    {
+        g_drw_vidmem.texture.live--;
+        if (0U == g_drw_vidmem.texture.live)
+        {
+            g_drw_vidmem.texture.offset = 0U;
+        }
+    }
+    else if (r_drw_arena_contains(&g_drw_vidmem.frame, ptr))
+    {
+        /* Frame arena memory is released by R_DRW_VidmemFrameReset. */
+    }
+    else
+    {
+        pooled = false;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return pooled;
+}
+
 /*******************************************************************************************************************//**
  * @}
  **********************************************************************************************************************/
@@ -0,0 +1,71 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/**********************************************************************************************************************
+ * File Name    : r_drw_memory.h
+ * Description  : D/AVE D1 low-level driver video memory pool header file.
+ **********************************************************************************************************************/
+
+#ifndef DRW_MEMORY_H
+#define DRW_MEMORY_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Alignment of all allocations made from the video memory pool. */
+#define DRW_VIDMEM_ALIGNMENT    (8U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Video memory pool configuration. Regions that are not used can be set to NULL. All regions must be aligned to
+ *  DRW_VIDMEM_ALIGNMENT. */
+typedef struct st_drw_vidmem_cfg
+{
+    void   * p_dlist_slabs;            ///< Memory for display list slabs
+    uint32_t dlist_slab_size;          ///< Size of one slab in bytes. Must cover one display list block allocation.
+    uint32_t dlist_slab_count;         ///< Number of slabs in p_dlist_slabs
+    void   * p_texture_region;         ///< Memory for textures, for example in SDRAM
+    uint32_t texture_region_size;      ///< Size of p_texture_region in bytes
+    void   * p_frame_arena;            ///< Memory for per-frame allocations made with R_DRW_VidmemFrameAlloc
+    uint32_t frame_arena_size;         ///< Size of p_frame_arena in bytes
+} drw_vidmem_cfg_t;
+
+/** Video memory pool statistics. */
+typedef struct st_drw_vidmem_stats
+{
+    uint32_t dlist_slabs_used;         ///< Display list slabs currently allocated
+    uint32_t dlist_slabs_peak;         ///< Highest number of display list slabs allocated at once
+    uint32_t texture_bytes_used;       ///< Bytes currently allocated from the texture region
+    uint32_t texture_bytes_peak;       ///< Highest number of bytes allocated from the texture region
+    uint32_t frame_bytes_used;         ///< Bytes allocated from the frame arena since the last reset
+    uint32_t frame_bytes_peak;         ///< Highest number of bytes allocated from the frame arena in one frame
+    uint32_t heap_allocs;              ///< Video memory allocations that were served by the heap
+    uint32_t heap_frees;               ///< Video memory blocks that were returned to the heap
+} drw_vidmem_stats_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_VidmemPoolInit(drw_vidmem_cfg_t const * const p_cfg);
+void    * R_DRW_VidmemFrameAlloc(uint32_t size);
+void      R_DRW_VidmemFrameReset(void);
+fsp_err_t R_DRW_VidmemStatsGet(drw_vidmem_stats_t * const p_stats);
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -0,0 +1,273 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/**********************************************************************************************************************
+ * File Name    : r_drw_pipeline.c
+ * Description  : This file defines D/AVE 2D frame pipelining. The CPU records the next frame into one render buffer
+ *                while the GPU executes the previous frame from the other render buffer.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#include "r_drw_pipeline.h"
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t r_drw_pipeline_flush(drw_pipeline_t * const p_pipeline);
+static uint32_t  r_drw_pipeline_cycles(void);
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Create the render buffers of the pipeline and configure the performance counter used to measure GPU busy time.
+ * The D/AVE 2D device must be opened and initialized with d2_opendevice and d2_inithw before calling this function.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ * @param[in] p_d2          D/AVE 2D device handle.
+ * @param[in] initial_size  Initial size of each render buffer, passed to d2_newrenderbuffer.
+ * @param[in] step_size     Growth step of each render buffer, passed to d2_newrenderbuffer.
+ *
+ * @retval FSP_SUCCESS           The pipeline is ready. Call R_DRW_PipelineFrameBegin to record the first frame.
+ * @retval FSP_ERR_ASSERTION     An input parameter is invalid.
+ * @retval FSP_ERR_OUT_OF_MEMORY A render buffer could not be allocated.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineOpen (drw_pipeline_t * const p_pipeline,
+                              d2_device * const      p_d2,
+                              uint32_t               initial_size,
+                              uint32_t               step_size)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_d2);
+#endif
+
+    p_pipeline->p_d2                  = p_d2;
+    p_pipeline->record_index          = 0U;
+    p_pipeline->gpu_busy              = false;
+    p_pipeline->d2_error              = D2_OK;
+    p_pipeline->stats.frames          = 0U;
+    p_pipeline->stats.cpu_wait_cycles = 0U;
+    p_pipeline->stats.gpu_busy_cycles = 0U;
+
+    for (uint32_t i = 0U; i < DRW_PIPELINE_NUM_BUFFERS; i++)
+    {
+        p_pipeline->p_buffers[i] = d2_newrenderbuffer(p_d2, (d2_u32) initial_size, (d2_u32) step_size);
+        if (NULL == p_pipeline->p_buffers[i])
+        {
+            /* Release the render buffers created so far. */
+            while (i > 0U)
+            {
+                i--;
+                d2_freerenderbuffer(p_d2, p_pipeline->p_buffers[i]);
+                p_pipeline->p_buffers[i] = NULL;
+            }
+
+            return FSP_ERR_OUT_OF_MEMORY;
+        }
+    }
+
+    /* Count D/AVE 2D cycles so the GPU busy time of each frame can be read when it is flushed. */
+    d2_setperfcountevent(p_d2, DRW_PIPELINE_PERF_COUNTER, d2_pc_davecycles);
+    d2_setperfcountvalue(p_d2, DRW_PIPELINE_PERF_COUNTER, 0);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Select the render buffer for the next frame. All following D/AVE 2D drawing calls are recorded into it. This does
+ * not wait for the GPU, so recording overlaps with the execution of the previously submitted frame.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS          Recording of the next frame started.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ * @retval FSP_ERR_INTERNAL     D/AVE 2D reported an error. The error code is stored in drw_pipeline_t::d2_error.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineFrameBegin (drw_pipeline_t * const p_pipeline)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_pipeline->p_d2);
+#endif
+
+    p_pipeline->d2_error = d2_selectrenderbuffer(p_pipeline->p_d2, p_pipeline->p_buffers[p_pipeline->record_index]);
+    FSP_ERROR_RETURN(D2_OK == p_pipeline->d2_error, FSP_ERR_INTERNAL);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Submit the recorded frame to the GPU. If the previous frame is still being executed, this function first waits for
+ * it to complete. The wait is done by d2_flushframe, which blocks on the D/AVE 2D interrupt. The function returns as
+ * soon as the GPU starts the new frame, so the CPU can record the next frame while the GPU renders this one.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS          The frame was submitted.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ * @retval FSP_ERR_INTERNAL     D/AVE 2D reported an error. The error code is stored in drw_pipeline_t::d2_error.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineFrameSubmit (drw_pipeline_t * const p_pipeline)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_pipeline->p_d2);
+#endif
+
+    /* Only one frame can be executed at a time. */
+    fsp_err_t err = r_drw_pipeline_flush(p_pipeline);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_pipeline->d2_error =
+        d2_executerenderbuffer(p_pipeline->p_d2, p_pipeline->p_buffers[p_pipeline->record_index], 0U);
+    FSP_ERROR_RETURN(D2_OK == p_pipeline->d2_error, FSP_ERR_INTERNAL);
+
+    p_pipeline->gpu_busy     = true;
+    p_pipeline->record_index = (p_pipeline->record_index + 1U) % DRW_PIPELINE_NUM_BUFFERS;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Wait until the last submitted frame has been rendered, for example before the frame buffer is handed to the display.
+ * Returns immediately if no frame is being executed.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS          No frame is being executed.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ * @retval FSP_ERR_INTERNAL     D/AVE 2D reported an error. The error code is stored in drw_pipeline_t::d2_error.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineFrameWait (drw_pipeline_t * const p_pipeline)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_pipeline->p_d2);
+#endif
+
+    return r_drw_pipeline_flush(p_pipeline);
+}
+
+/*******************************************************************************************************************//**
+ * Get the frame timing statistics. The ratio of CPU wait cycles to GPU busy cycles shows whether the CPU or the GPU
+ * limits the frame rate.
+ *
+ * @param[in]  p_pipeline   Pointer to the pipeline control block.
+ * @param[out] p_stats      Statistics since R_DRW_PipelineOpen.
+ *
+ * @retval FSP_SUCCESS          Statistics copied to p_stats.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineStatsGet (drw_pipeline_t * const p_pipeline, drw_pipeline_stats_t * const p_stats)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_stats);
+#endif
+
+    *p_stats = p_pipeline->stats;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Wait for the last submitted frame and free the render buffers of the pipeline.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS          The pipeline was closed.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ * @retval FSP_ERR_INTERNAL     D/AVE 2D reported an error. The error code is stored in drw_pipeline_t::d2_error.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineClose (drw_pipeline_t * const p_pipeline)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_pipeline->p_d2);
+#endif
+
+    fsp_err_t err = r_drw_pipeline_flush(p_pipeline);
+
+    /* Make the default render buffer current again before the pipeline buffers are freed. */
+    d2_selectrenderbuffer(p_pipeline->p_d2, d2_getrenderbuffer(p_pipeline->p_d2, 0));
+
+    for (uint32_t i = 0U; i < DRW_PIPELINE_NUM_BUFFERS; i++)
+    {
+        d2_freerenderbuffer(p_pipeline->p_d2, p_pipeline->p_buffers[i]);
+        p_pipeline->p_buffers[i] = NULL;
+    }
+
+    p_pipeline->p_d2 = NULL;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @internal
+ * @addtogroup DRW_PRV Internal DRW Documentation
+ * @ingroup RENESAS_INTERNAL
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Wait for the frame being executed by the GPU and update the frame statistics.
+ *
+ * @param[in] p_pipeline    Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS          No frame is being executed.
+ * @retval FSP_ERR_INTERNAL     d2_flushframe reported an error.
+ **********************************************************************************************************************/
+static fsp_err_t r_drw_pipeline_flush (drw_pipeline_t * const p_pipeline)
+{
+    if (p_pipeline->gpu_busy)
+    {
+        uint32_t start = r_drw_pipeline_cycles();
+
+        /* d2_flushframe blocks on the D/AVE 2D interrupt until the GPU has finished the frame. */
+        p_pipeline->d2_error = d2_flushframe(p_pipeline->p_d2);
+
+        p_pipeline->stats.cpu_wait_cycles += (uint32_t) (r_drw_pipeline_cycles() - start);
+        p_pipeline->gpu_busy               = false;
+
+        FSP_ERROR_RETURN(D2_OK == p_pipeline->d2_error, FSP_ERR_INTERNAL);
+
+        /* Collect the GPU cycles of the completed frame and restart the count for the next one. */
+        p_pipeline->stats.gpu_busy_cycles +=
+            (uint32_t) d2_getperfcountvalue(p_pipeline->p_d2, DRW_PIPELINE_PERF_COUNTER);
+        d2_setperfcountvalue(p_pipeline->p_d2, DRW_PIPELINE_PERF_COUNTER, 0);
+        p_pipeline->stats.frames++;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Read the CPU cycle counter. The DWT cycle counter must be enabled by the application to measure CPU wait time.
+ *
+ * @return Current value of the cycle counter, or 0 if the device has no cycle counter.
+ **********************************************************************************************************************/
+static uint32_t r_drw_pipeline_cycles (void)
+{
+#if BSP_FEATURE_DWT_CYCCNT
+    return DWT->CYCCNT;
+#else
+    return 0U;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @}
+ **********************************************************************************************************************/
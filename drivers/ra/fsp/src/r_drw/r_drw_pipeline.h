@@ -0,0 +1,74 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/**********************************************************************************************************************
+ * File Name    : r_drw_pipeline.h
+ * Description  : D/AVE 2D frame pipelining header file.
+ **********************************************************************************************************************/
+
+#ifndef DRW_PIPELINE_H
+#define DRW_PIPELINE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "dave_driver.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Number of render buffers used by the pipeline. */
+#define DRW_PIPELINE_NUM_BUFFERS     (2U)
+
+/** D/AVE 2D performance counter used to measure GPU busy time. Counter 1 is used so that counter 0 stays free for
+ *  the frame profiler; leave this counter out of drw_profile_cfg_t::counter_mask while the pipeline is open. */
+#define DRW_PIPELINE_PERF_COUNTER    (1U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Frame timing statistics. */
+typedef struct st_drw_pipeline_stats
+{
+    uint32_t frames;                   ///< Number of frames completed by the GPU
+    uint64_t cpu_wait_cycles;          ///< CPU cycles spent waiting for the GPU, 0 if the DWT cycle counter is disabled
+    uint64_t gpu_busy_cycles;          ///< D/AVE 2D cycles counted by d2_pc_davecycles while rendering
+} drw_pipeline_stats_t;
+
+/** Frame pipeline control block. DO NOT INITIALIZE. Initialized in R_DRW_PipelineOpen. */
+typedef struct st_drw_pipeline
+{
+    d2_device          * p_d2;                                ///< D/AVE 2D device handle
+    d2_renderbuffer    * p_buffers[DRW_PIPELINE_NUM_BUFFERS]; ///< Render buffers used alternately
+    uint32_t             record_index;                        ///< Render buffer being recorded by the CPU
+    bool                 gpu_busy;                            ///< A submitted frame has not been flushed yet
+    d2_s32               d2_error;                            ///< Last D/AVE 2D error code
+    drw_pipeline_stats_t stats;                               ///< Frame timing statistics
+} drw_pipeline_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_PipelineOpen(drw_pipeline_t * const p_pipeline,
+                             d2_device * const      p_d2,
+                             uint32_t               initial_size,
+                             uint32_t               step_size);
+fsp_err_t R_DRW_PipelineFrameBegin(drw_pipeline_t * const p_pipeline);
+fsp_err_t R_DRW_PipelineFrameSubmit(drw_pipeline_t * const p_pipeline);
+fsp_err_t R_DRW_PipelineFrameWait(drw_pipeline_t * const p_pipeline);
+fsp_err_t R_DRW_PipelineStatsGet(drw_pipeline_t * const p_pipeline, drw_pipeline_stats_t * const p_stats);
+fsp_err_t R_DRW_PipelineClose(drw_pipeline_t * const p_pipeline);
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
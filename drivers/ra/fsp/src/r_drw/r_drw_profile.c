@@ -0,0 +1,240 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/**********************************************************************************************************************
+ * File Name    : r_drw_profile.c
+ * Description  : This file defines D/AVE 2D per-frame performance counter profiling. The configured events are
+ *                sampled once per frame and collected into histograms over a window of frames.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+
+#include "bsp_api.h"
+
+#include "r_drw_profile.h"
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void r_drw_profile_window_reset(drw_profile_t * const p_profile);
+static void r_drw_profile_record(drw_profile_histogram_t * p_histogram, uint32_t value, uint8_t bin_shift);
+static void r_drw_profile_assign(drw_profile_t * const p_profile, uint32_t counter_index);
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Start profiling. The configured events are assigned to the hardware counters selected by counter_mask. If there are
+ * more events than counters, the events are rotated over the counters from frame to frame, so each event is sampled
+ * in a fraction of the frames.
+ *
+ * @param[in] p_profile     Pointer to the profiling control block.
+ * @param[in] p_cfg         Profiling configuration.
+ *
+ * @retval FSP_SUCCESS          Profiling started.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_ProfileOpen (drw_profile_t * const p_profile, drw_profile_cfg_t const * const p_cfg)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_profile);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_d2);
+    FSP_ASSERT(NULL != p_cfg->p_events);
+    FSP_ASSERT((0U != p_cfg->num_events) && (p_cfg->num_events <= DRW_PROFILE_MAX_EVENTS));
+    FSP_ASSERT(0U != (p_cfg->counter_mask & ((1U << DRW_PROFILE_NUM_COUNTERS) - 1U)));
+    FSP_ASSERT(0U != p_cfg->window_frames);
+#endif
+
+    p_profile->p_cfg        = p_cfg;
+    p_profile->num_counters = 0U;
+    p_profile->next_event   = 0U;
+    p_profile->windows      = 0U;
+
+    r_drw_profile_window_reset(p_profile);
+
+    for (uint32_t counter = 0U; counter < DRW_PROFILE_NUM_COUNTERS; counter++)
+    {
+        if ((0U != (p_cfg->counter_mask & (1U << counter))) && (p_profile->num_counters < p_cfg->num_events))
+        {
+            p_profile->counters[p_profile->num_counters] = counter;
+            r_drw_profile_assign(p_profile, p_profile->num_counters);
+            p_profile->num_counters++;
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sample the hardware counters for the frame that just completed. Call this function after d2_endframe (or after the
+ * frame has been flushed) once per frame. At the end of each window the histograms are copied to the export buffer,
+ * passed to the callback and cleared.
+ *
+ * @param[in] p_profile     Pointer to the profiling control block.
+ *
+ * @retval FSP_SUCCESS          Counters sampled.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_ProfileFrameEnd (drw_profile_t * const p_profile)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_profile);
+    FSP_ASSERT(NULL != p_profile->p_cfg);
+#endif
+
+    drw_profile_cfg_t const * p_cfg = p_profile->p_cfg;
+
+    for (uint32_t i = 0U; i < p_profile->num_counters; i++)
+    {
+        d2_slong value = d2_getperfcountvalue(p_cfg->p_d2, p_profile->counters[i]);
+        r_drw_profile_record(&p_profile->histograms[p_profile->sampling[i]], (uint32_t) value, p_cfg->bin_shift);
+
+        /* Move the counter to the next event and restart it for the next frame. */
+        r_drw_profile_assign(p_profile, i);
+    }
+
+    p_profile->frames++;
+    if (p_profile->frames >= p_cfg->window_frames)
+    {
+        if (NULL != p_cfg->p_export)
+        {
+            memcpy(p_cfg->p_export, p_profile->histograms, p_cfg->num_events * sizeof(drw_profile_histogram_t));
+        }
+
+        if (NULL != p_cfg->p_callback)
+        {
+            drw_profile_callback_args_t args;
+            args.p_histograms = p_profile->histograms;
+            args.num_events   = p_cfg->num_events;
+            args.window       = p_profile->windows;
+            args.p_context    = p_cfg->p_context;
+
+            p_cfg->p_callback(&args);
+        }
+
+        p_profile->windows++;
+        r_drw_profile_window_reset(p_profile);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stop profiling and disable the hardware counters used by the profiler.
+ *
+ * @param[in] p_profile     Pointer to the profiling control block.
+ *
+ * @retval FSP_SUCCESS          Profiling stopped.
+ * @retval FSP_ERR_ASSERTION    An input parameter is invalid.
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_ProfileClose (drw_profile_t * const p_profile)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_profile);
+    FSP_ASSERT(NULL != p_profile->p_cfg);
+#endif
+
+    for (uint32_t i = 0U; i < p_profile->num_counters; i++)
+    {
+        d2_setperfcountevent(p_profile->p_cfg->p_d2, p_profile->counters[i], d2_pc_disable);
+    }
+
+    p_profile->num_counters = 0U;
+    p_profile->p_cfg        = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @internal
+ * @addtogroup DRW_PRV Internal DRW Documentation
+ * @ingroup RENESAS_INTERNAL
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Clear the histograms for a new window.
+ *
+ * @param[in] p_profile     Pointer to the profiling control block.
+ **********************************************************************************************************************/
+static void r_drw_profile_window_reset (drw_profile_t * const p_profile)
+{
+    drw_profile_cfg_t const * p_cfg = p_profile->p_cfg;
+
+    memset(p_profile->histograms, 0, sizeof(p_profile->histograms));
+
+    for (uint32_t i = 0U; i < p_cfg->num_events; i++)
+    {
+        p_profile->histograms[i].event = p_cfg->p_events[i];
+        p_profile->histograms[i].min   = UINT32_MAX;
+    }
+
+    p_profile->frames = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Add one sampled value to a histogram.
+ *
+ * @param[in] p_histogram   Histogram to update.
+ * @param[in] value         Value of the event for one frame.
+ * @param[in] bin_shift     Right shift applied to the value before it is binned.
+ **********************************************************************************************************************/
+static void r_drw_profile_record (drw_profile_histogram_t * p_histogram, uint32_t value, uint8_t bin_shift)
+{
+    uint32_t scaled = value >> bin_shift;
+    uint32_t bin    = (0U == scaled) ? 0U : (32U - __CLZ(scaled));
+
+    if (bin >= DRW_PROFILE_HISTOGRAM_BINS)
+    {
+        bin = DRW_PROFILE_HISTOGRAM_BINS - 1U;
+    }
+
+    p_histogram->bins[bin]++;
+    p_histogram->samples++;
+    p_histogram->sum += value;
+
+    if (value < p_histogram->min)
+    {
+        p_histogram->min = value;
+    }
+
+    if (value > p_histogram->max)
+    {
+        p_histogram->max = value;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Assign the next event of the set to a hardware counter and clear the counter.
+ *
+ * @param[in] p_profile     Pointer to the profiling control block.
+ * @param[in] counter_index Index into drw_profile_t::counters.
+ **********************************************************************************************************************/
+static void r_drw_profile_assign (drw_profile_t * const p_profile, uint32_t counter_index)
+{
+    drw_profile_cfg_t const * p_cfg   = p_profile->p_cfg;
+    uint32_t                  counter = p_profile->counters[counter_index];
+
+    /* With one event per counter the assignment never changes, so the event does not need to be rewritten. */
+    if (p_profile->num_counters < p_cfg->num_events)
+    {
+        p_profile->sampling[counter_index] = p_profile->next_event;
+        d2_setperfcountevent(p_cfg->p_d2, counter, p_cfg->p_events[p_profile->next_event]);
+
+        p_profile->next_event = (p_profile->next_event + 1U) % p_cfg->num_events;
+    }
+
+    d2_setperfcountvalue(p_cfg->p_d2, counter, 0);
+}
+
+/*******************************************************************************************************************//**
+ * @}
+ **********************************************************************************************************************/
@@ -0,0 +1,103 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/**********************************************************************************************************************
+ * File Name    : r_drw_profile.h
+ * Description  : D/AVE 2D per-frame performance counter profiling header file.
+ **********************************************************************************************************************/
+
+#ifndef DRW_PROFILE_H
+#define DRW_PROFILE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "dave_driver.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Number of D/AVE 2D hardware performance counters. */
+#define DRW_PROFILE_NUM_COUNTERS      (2U)
+
+/** Maximum number of events in a profiling set. */
+#define DRW_PROFILE_MAX_EVENTS        (8U)
+
+/** Number of histogram bins. Bin 0 counts zero values, bin n counts values in [2^(n-1), 2^n). The last bin also
+ *  counts all larger values. */
+#define DRW_PROFILE_HISTOGRAM_BINS    (16U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Histogram of the per-frame values of one event. */
+typedef struct st_drw_profile_histogram
+{
+    uint32_t event;                                ///< Event from d2_perfcountevents
+    uint32_t samples;                              ///< Number of frames sampled in the window
+    uint32_t min;                                  ///< Smallest sampled value
+    uint32_t max;                                  ///< Largest sampled value
+    uint64_t sum;                                  ///< Sum of the sampled values
+    uint32_t bins[DRW_PROFILE_HISTOGRAM_BINS];     ///< Histogram bins, see DRW_PROFILE_HISTOGRAM_BINS
+} drw_profile_histogram_t;
+
+/** Arguments passed to the profiling callback at the end of each window. */
+typedef struct st_drw_profile_callback_args
+{
+    drw_profile_histogram_t const * p_histograms; ///< One histogram per configured event
+    uint32_t                        num_events;   ///< Number of histograms
+    uint32_t                        window;       ///< Index of the completed window
+    void                          * p_context;    ///< Placeholder for user data
+} drw_profile_callback_args_t;
+
+/** Profiling configuration. The frame pipeline uses counter DRW_PIPELINE_PERF_COUNTER (1) while it is open, so set
+ *  counter_mask to 0x01 when profiling alongside it. */
+typedef struct st_drw_profile_cfg
+{
+    d2_device      * p_d2;                      ///< D/AVE 2D device handle
+    uint32_t const * p_events;                  ///< Events from d2_perfcountevents to sample
+    uint32_t         num_events;                ///< Number of events, up to DRW_PROFILE_MAX_EVENTS
+    uint8_t          counter_mask;              ///< Hardware counters the profiler may use, bit n for counter n
+    uint8_t          bin_shift;                 ///< Right shift applied to values before they are binned
+    uint32_t         window_frames;             ///< Number of frames in each histogram window
+
+    /** Optional buffer of num_events histograms. Each completed window is copied here. */
+    drw_profile_histogram_t * p_export;
+
+    void (* p_callback)(drw_profile_callback_args_t * p_args); ///< Optional callback at the end of each window
+    void * p_context;                                          ///< Placeholder for user data
+} drw_profile_cfg_t;
+
+/** Profiling control block. DO NOT INITIALIZE. Initialized in R_DRW_ProfileOpen. */
+typedef struct st_drw_profile
+{
+    drw_profile_cfg_t const * p_cfg;                                ///< Pointer to the configuration
+    uint32_t                  counters[DRW_PROFILE_NUM_COUNTERS];   ///< Hardware counters in use
+    uint32_t                  num_counters;                         ///< Number of hardware counters in use
+    uint32_t                  sampling[DRW_PROFILE_NUM_COUNTERS];   ///< Event index sampled by each counter
+    uint32_t                  next_event;                           ///< Next event index to assign to a counter
+    uint32_t                  frames;                               ///< Frames in the current window
+    uint32_t                  windows;                              ///< Number of completed windows
+    drw_profile_histogram_t   histograms[DRW_PROFILE_MAX_EVENTS];   ///< Histograms of the current window
+} drw_profile_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t R_DRW_ProfileOpen(drw_profile_t * const p_profile, drw_profile_cfg_t const * const p_cfg);
+fsp_err_t R_DRW_ProfileFrameEnd(drw_profile_t * const p_profile);
+fsp_err_t R_DRW_ProfileClose(drw_profile_t * const p_profile);
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
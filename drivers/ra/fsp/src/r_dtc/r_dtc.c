@@ -37,6 +37,12 @@
  * for expressions that cannot be evaluated by the preprocessor like sizeof(). */
 #define DTC_COMPILE_TIME_ASSERT(e)       ((void) sizeof(char[1 - 2 * !(e)]))
 
+/* Longest chain accepted by the parameter checking of R_DTC_Open and R_DTC_Reconfigure. A chain that does not end
+ * within this many entries is rejected as unterminated. */
+#ifndef DTC_CFG_CHAIN_MAX_ENTRIES
+ #define DTC_CFG_CHAIN_MAX_ENTRIES       (256U)
+#endif
+
 /* Calculate the mask bits for byte alignment from the transfer_size_t. */
 #define DTC_PRV_MASK_ALIGN_N_BYTES(x)    ((1U << (x)) - 1U)
 
@@ -82,6 +88,12 @@ static fsp_err_t r_dtc_source_destination_parameter_check(transfer_info_t * p_in
 
 static void r_dtc_wait_for_transfer_complete(dtc_instance_ctrl_t * p_ctrl);
 static void r_dtc_disable_transfer(const IRQn_Type irq);
+static fsp_err_t r_dtc_chain_append(dtc_chain_t * const p_chain,
+                                    uint32_t            settings,
+                                    void const * const  p_src,
+                                    void * const        p_dest,
+                                    uint16_t            num_blocks,
+                                    uint16_t            length);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -131,7 +143,13 @@ const transfer_api_t g_transfer_on_dtc =
  *                                      Module started.
  *                                      DTC vector table configured.
  * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
- * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected.
+ * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected, or the transfer info chain uses a mode, transfer
+ *                                  size or chain mode the DTC does not support.
+ * @retval FSP_ERR_INVALID_ALIGNMENT The source or destination of a transfer info entry is not aligned with its transfer
+ *                                  size.
+ * @retval FSP_ERR_INVALID_SIZE     The length of a repeat or block mode transfer info entry is larger than
+ *                                  DTC_MAX_REPEAT_TRANSFER_LENGTH.
+ * @retval FSP_ERR_OVERFLOW         The transfer info chain does not end within DTC_CFG_CHAIN_MAX_ENTRIES entries.
  * @retval FSP_ERR_ALREADY_OPEN     The control structure is already opened.
  * @retval FSP_ERR_IN_USE           The index for this IRQ in the DTC vector table is already configured.
  * @retval FSP_ERR_IRQ_BSP_DISABLED The IRQ associated with the activation source is not enabled in the BSP.
@@ -168,7 +186,9 @@ fsp_err_t R_DTC_Open (transfer_ctrl_t * const p_api_ctrl, transfer_cfg_t const *
     if (p_cfg->p_info)
     {
 #if DTC_CFG_PARAM_CHECKING_ENABLE
-        fsp_err_t err = r_dtc_length_assert(p_cfg->p_info);
+        fsp_err_t err = R_DTC_ChainValidate(p_cfg->p_info, DTC_CFG_CHAIN_MAX_ENTRIES, NULL);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        err = r_dtc_length_assert(p_cfg->p_info);
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 #endif
         r_dtc_set_info(p_ctrl, p_cfg->p_info);
@@ -189,6 +209,13 @@ fsp_err_t R_DTC_Open (transfer_ctrl_t * const p_api_ctrl, transfer_cfg_t const *
  * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
  * @retval FSP_ERR_NOT_ENABLED      Transfer source address is NULL or is not aligned correctly.
  *                                  Transfer destination address is NULL or is not aligned correctly.
+ * @retval FSP_ERR_UNSUPPORTED      The transfer info chain uses a mode, transfer size, chain mode or address mode the
+ *                                  DTC does not support.
+ * @retval FSP_ERR_INVALID_ALIGNMENT The source or destination of a transfer info entry is not aligned with its transfer
+ *                                  size.
+ * @retval FSP_ERR_INVALID_SIZE     The length of a repeat or block mode transfer info entry is larger than
+ *                                  DTC_MAX_REPEAT_TRANSFER_LENGTH.
+ * @retval FSP_ERR_OVERFLOW         The transfer info chain does not end within DTC_CFG_CHAIN_MAX_ENTRIES entries.
  *
  * @note p_info must persist until all transfers are completed.
  **********************************************************************************************************************/
@@ -200,6 +227,8 @@ fsp_err_t R_DTC_Reconfigure (transfer_ctrl_t * const p_api_ctrl, transfer_info_t
     FSP_ASSERT(NULL != p_ctrl);
     FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
     FSP_ASSERT(NULL != p_info);
+    fsp_err_t err = R_DTC_ChainValidate(p_info, DTC_CFG_CHAIN_MAX_ENTRIES, NULL);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
     FSP_ASSERT(FSP_SUCCESS == r_dtc_length_assert(p_info));
 #endif
 
@@ -483,6 +512,238 @@ fsp_err_t R_DTC_Close (transfer_ctrl_t * const p_api_ctrl)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Initialize a chain builder with caller provided storage for the chain entries. The storage must remain valid while
+ * the chain is installed.
+ *
+ * @retval FSP_SUCCESS                Chain builder initialized and empty.
+ * @retval FSP_ERR_ASSERTION          An input parameter is invalid.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  p_info is not aligned with BSP_FEATURE_DTC_TRANSFER_INFO_ALIGNMENT.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainInit (dtc_chain_t * const p_chain, transfer_info_t * const p_info, uint16_t max_entries)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_chain);
+    FSP_ASSERT(NULL != p_info);
+    FSP_ASSERT(0U != max_entries);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_info & (BSP_FEATURE_DTC_TRANSFER_INFO_ALIGNMENT - 1U)),
+                     FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    p_chain->p_info      = p_info;
+    p_chain->max_entries = max_entries;
+    p_chain->num_entries = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Append a register write to a chain. Each activation writes the next value from p_values to p_reg. After the last
+ * value the sequence restarts from the first value, so the entry never ends.
+ *
+ * @retval FSP_SUCCESS                Entry appended.
+ * @retval FSP_ERR_ASSERTION          An input parameter is invalid.
+ * @retval FSP_ERR_INVALID_SIZE       num_values is 0 or larger than DTC_MAX_REPEAT_TRANSFER_LENGTH.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  p_reg or p_values is not aligned with size.
+ * @retval FSP_ERR_UNSUPPORTED        size is not supported by the DTC.
+ * @retval FSP_ERR_OVERFLOW           The chain storage is full.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainRegisterWrite (dtc_chain_t * const p_chain,
+                                    void * const        p_reg,
+                                    void const * const  p_values,
+                                    transfer_size_t     size,
+                                    uint16_t            num_values)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN((0U != num_values) && (num_values <= DTC_MAX_REPEAT_TRANSFER_LENGTH), FSP_ERR_INVALID_SIZE);
+#endif
+
+    transfer_info_t info = {0};
+    info.transfer_settings_word_b.mode           = TRANSFER_MODE_REPEAT;
+    info.transfer_settings_word_b.size           = size;
+    info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+
+    return r_dtc_chain_append(p_chain, info.transfer_settings_word, p_values, p_reg, 0U, num_values);
+}
+
+/*******************************************************************************************************************//**
+ * Append a gather to a chain. Each activation reads num_regs consecutive registers starting at p_regs and stores them
+ * at the next position of p_dest. The entry ends after num_blocks activations.
+ *
+ * @retval FSP_SUCCESS                Entry appended.
+ * @retval FSP_ERR_ASSERTION          An input parameter is invalid.
+ * @retval FSP_ERR_INVALID_SIZE       num_regs or num_blocks is out of range for block mode.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  p_regs or p_dest is not aligned with size.
+ * @retval FSP_ERR_UNSUPPORTED        size is not supported by the DTC.
+ * @retval FSP_ERR_OVERFLOW           The chain storage is full.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainGather (dtc_chain_t * const p_chain,
+                             void const * const  p_regs,
+                             void * const        p_dest,
+                             transfer_size_t     size,
+                             uint16_t            num_regs,
+                             uint16_t            num_blocks)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN((0U != num_regs) && (num_regs <= DTC_MAX_BLOCK_TRANSFER_LENGTH), FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN(0U != num_blocks, FSP_ERR_INVALID_SIZE);
+#endif
+
+    transfer_info_t info = {0};
+    info.transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    info.transfer_settings_word_b.size           = size;
+    info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+
+    return r_dtc_chain_append(p_chain, info.transfer_settings_word, p_regs, p_dest, num_blocks, num_regs);
+}
+
+/*******************************************************************************************************************//**
+ * Append a scatter to a chain. Each activation writes the next num_regs values from p_src to num_regs consecutive
+ * registers starting at p_regs. The entry ends after num_blocks activations.
+ *
+ * @retval FSP_SUCCESS                Entry appended.
+ * @retval FSP_ERR_ASSERTION          An input parameter is invalid.
+ * @retval FSP_ERR_INVALID_SIZE       num_regs or num_blocks is out of range for block mode.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  p_src or p_regs is not aligned with size.
+ * @retval FSP_ERR_UNSUPPORTED        size is not supported by the DTC.
+ * @retval FSP_ERR_OVERFLOW           The chain storage is full.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainScatter (dtc_chain_t * const p_chain,
+                              void const * const  p_src,
+                              void * const        p_regs,
+                              transfer_size_t     size,
+                              uint16_t            num_regs,
+                              uint16_t            num_blocks)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN((0U != num_regs) && (num_regs <= DTC_MAX_BLOCK_TRANSFER_LENGTH), FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN(0U != num_blocks, FSP_ERR_INVALID_SIZE);
+#endif
+
+    transfer_info_t info = {0};
+    info.transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    info.transfer_settings_word_b.size           = size;
+    info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+
+    return r_dtc_chain_append(p_chain, info.transfer_settings_word, p_src, p_regs, num_blocks, num_regs);
+}
+
+/*******************************************************************************************************************//**
+ * Link the entries of a chain and install it on the activation source of an open DTC instance. Transfers on the
+ * activation source are disabled and any transfer in progress completes before the vector table entry is replaced, so
+ * the DTC never executes a partially installed chain.
+ *
+ * The installed chain storage must not be modified while it is in use. To change the sequence while it runs, build
+ * the new chain in separate storage and install it. Installing writes the reload count back into the entries, so
+ * start again with R_DTC_ChainInit before reusing the previous storage.
+ *
+ * @retval FSP_SUCCESS              Chain installed and transfers enabled.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid or the chain is empty.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls: @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainInstall (transfer_ctrl_t * const p_api_ctrl, dtc_chain_t * const p_chain)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_chain);
+    FSP_ASSERT(0U != p_chain->num_entries);
+#endif
+
+    /* Chain every entry to the next one after each transfer. The last entry ends the chain. */
+    uint32_t last = p_chain->num_entries - 1U;
+    for (uint32_t i = 0U; i < last; i++)
+    {
+        p_chain->p_info[i].transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_EACH;
+    }
+
+    p_chain->p_info[last].transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+
+    return R_DTC_Reconfigure(p_api_ctrl, p_chain->p_info);
+}
+
+/*******************************************************************************************************************//**
+ * Walk a chain of transfer info entries the way the DTC does and check each entry against the DTC limits. The chain
+ * is not modified and no hardware is accessed, so this function can also be used to check chains in unit tests.
+ *
+ * Entries of a chain are consecutive in memory, so a chain can only run away by never reaching an entry with
+ * TRANSFER_CHAIN_MODE_DISABLED. Such a chain is reported once max_entries entries have been checked.
+ *
+ * Repeat and block mode lengths must be in the form set by the application (at most 256), the same contract R_DTC_Open
+ * and R_DTC_Reconfigure enforce. Entries that have been installed hold the count in both bytes of the length and are
+ * reported as FSP_ERR_INVALID_SIZE, so rebuild a chain before installing its storage again.
+ *
+ * @param[in]  p_info                 First entry of the chain.
+ * @param[in]  max_entries            Number of entries available in the chain storage.
+ * @param[out] p_num_entries          Number of entries in the chain. May be NULL.
+ *
+ * @retval FSP_SUCCESS                The chain ends within max_entries and every entry is valid.
+ * @retval FSP_ERR_ASSERTION          p_info is NULL or max_entries is 0.
+ * @retval FSP_ERR_OVERFLOW           No entry within max_entries ends the chain.
+ * @retval FSP_ERR_UNSUPPORTED        An entry uses a mode, transfer size, chain mode or address mode the DTC does not
+ *                                    support.
+ * @retval FSP_ERR_INVALID_SIZE       The length of a repeat or block mode entry is larger than
+ *                                    DTC_MAX_REPEAT_TRANSFER_LENGTH.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  The source or destination of an entry is not aligned with its transfer size.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainValidate (transfer_info_t const * const p_info, uint32_t max_entries, uint32_t * const p_num_entries)
+{
+    FSP_ERROR_RETURN(NULL != p_info, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(0U != max_entries, FSP_ERR_ASSERTION);
+
+    uint32_t i = 0U;
+    transfer_chain_mode_t chain_mode;
+
+    do
+    {
+        FSP_ERROR_RETURN(i < max_entries, FSP_ERR_OVERFLOW);
+
+        transfer_info_t const * p_entry = &p_info[i];
+        transfer_mode_t         mode    = p_entry->transfer_settings_word_b.mode;
+        uint32_t                size    = (uint32_t) p_entry->transfer_settings_word_b.size;
+
+        chain_mode = p_entry->transfer_settings_word_b.chain_mode;
+
+        FSP_ERROR_RETURN((TRANSFER_CHAIN_MODE_DISABLED == chain_mode) || (TRANSFER_CHAIN_MODE_EACH == chain_mode) ||
+                         (TRANSFER_CHAIN_MODE_END == chain_mode),
+                         FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN((TRANSFER_MODE_NORMAL == mode) || (TRANSFER_MODE_REPEAT == mode) ||
+                         (TRANSFER_MODE_BLOCK == mode),
+                         FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN(size <= (uint32_t) TRANSFER_SIZE_4_BYTE, FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN(TRANSFER_ADDR_MODE_OFFSET != p_entry->transfer_settings_word_b.src_addr_mode,
+                         FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN(TRANSFER_ADDR_MODE_OFFSET != p_entry->transfer_settings_word_b.dest_addr_mode,
+                         FSP_ERR_UNSUPPORTED);
+
+        if (TRANSFER_MODE_NORMAL != mode)
+        {
+            /* transfer_length_max is the same for Block and repeat mode. */
+            FSP_ERROR_RETURN(p_entry->length <= DTC_MAX_REPEAT_TRANSFER_LENGTH, FSP_ERR_INVALID_SIZE);
+        }
+
+        /* Addresses may still be NULL if they are set later with R_DTC_Reset or R_DTC_Reload. */
+        FSP_ERROR_RETURN(0U == ((uint32_t) p_entry->p_src & DTC_PRV_MASK_ALIGN_N_BYTES(size)),
+                         FSP_ERR_INVALID_ALIGNMENT);
+        FSP_ERROR_RETURN(0U == ((uint32_t) p_entry->p_dest & DTC_PRV_MASK_ALIGN_N_BYTES(size)),
+                         FSP_ERR_INVALID_ALIGNMENT);
+
+        i++;
+    } while (TRANSFER_CHAIN_MODE_DISABLED != chain_mode);
+
+    if (NULL != p_num_entries)
+    {
+        *p_num_entries = i;
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup DTC)
  **********************************************************************************************************************/
@@ -689,3 +950,50 @@ static void r_dtc_disable_transfer (const IRQn_Type irq)
     R_ICU->DTCENCLR[(((uint32_t) irq) >> 5UL)] = 1UL << (((uint32_t) irq) & (uint32_t) 0x1FUL);
 #endif
 }
+
+/*******************************************************************************************************************//**
+ * Check an entry against the DTC limits and append it to a chain.
+ *
+ * @retval FSP_SUCCESS                Entry appended.
+ * @retval FSP_ERR_ASSERTION          An input parameter is invalid.
+ * @retval FSP_ERR_INVALID_ALIGNMENT  Source or destination is not aligned with the transfer size.
+ * @retval FSP_ERR_UNSUPPORTED        Transfer size is not supported by the DTC.
+ * @retval FSP_ERR_OVERFLOW           The chain storage is full.
+ **********************************************************************************************************************/
+static fsp_err_t r_dtc_chain_append (dtc_chain_t * const p_chain,
+                                     uint32_t            settings,
+                                     void const * const  p_src,
+                                     void * const        p_dest,
+                                     uint16_t            num_blocks,
+                                     uint16_t            length)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_chain);
+    FSP_ASSERT(NULL != p_chain->p_info);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ASSERT(NULL != p_dest);
+
+    transfer_info_t info = {0};
+    info.transfer_settings_word = settings;
+
+    /* The DTC transfers 1, 2 or 4 bytes at a time. */
+    uint32_t size = (uint32_t) info.transfer_settings_word_b.size;
+    FSP_ERROR_RETURN(size <= (uint32_t) TRANSFER_SIZE_4_BYTE, FSP_ERR_UNSUPPORTED);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_src & DTC_PRV_MASK_ALIGN_N_BYTES(size)), FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_dest & DTC_PRV_MASK_ALIGN_N_BYTES(size)), FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    /* The chain storage is checked even without parameter checking so entries are never written past its end. */
+    FSP_ERROR_RETURN(p_chain->num_entries < p_chain->max_entries, FSP_ERR_OVERFLOW);
+
+    transfer_info_t * p_info = &p_chain->p_info[p_chain->num_entries];
+    p_info->transfer_settings_word = settings;
+    p_info->p_src                  = p_src;
+    p_info->p_dest                 = p_dest;
+    p_info->num_blocks             = num_blocks;
+    p_info->length                 = length;
+
+    p_chain->num_entries++;
+
+    return FSP_SUCCESS;
+}
@@ -22,6 +22,11 @@
  * Macro definitions
  **********************************************************************************************************************/
 
+/* Number of frame buffers that can wait in the flip queue of each layer */
+#ifndef GLCDC_CFG_FLIP_QUEUE_DEPTH
+ #define GLCDC_CFG_FLIP_QUEUE_DEPTH                    (3)
+#endif
+
 /* The macro to use for 64-byte alignment checking, calculation */
 #define GLCDC_PRV_ADDRESS_ALIGNMENT_64B                (64U)
 
@@ -220,6 +225,8 @@ static inline uint16_t r_glcdc_get_bit_size(display_in_format_t const format);
 
 static void r_glcdc_interrupt_enable(glcdc_instance_ctrl_t * p_instance_ctrl);
 
+static void r_glcdc_flip_process(void);
+
 static void r_glcdc_pixel_size_recalculate(display_input_cfg_t const * const p_input,
                                            display_layer_t const * const     p_layer,
                                            glcdc_recalculated_param_t      * p_recalculated,
@@ -279,6 +286,16 @@ static volatile uint32_t g_frame_ctr       = 0;
 /* Tracks when an edited CLUT has been latched in */
 static volatile bool g_clut_data_latched[2] = {true, true};
 
+/* Flip queue. The head is advanced by R_GLCDC_FlipQueue and the tail by the line detect interrupt. */
+static uint8_t * volatile  g_flip_queue[2][GLCDC_CFG_FLIP_QUEUE_DEPTH];
+static volatile uint32_t   g_flip_head[2];
+static volatile uint32_t   g_flip_tail[2];
+static uint8_t           * g_flip_pending[2];   // Committed at the last line detect, scanned out from the next Vsync
+static uint8_t           * g_flip_displayed[2]; // Scanned out in the current frame
+static glcdc_flip_stats_t g_flip_stats;
+static void (* g_flip_callback)(glcdc_flip_callback_args_t * p_args);
+static void * g_flip_context;
+
 /* Look-up table for r_glcdc_tcon_set */
 static uint32_t volatile * g_tcon_lut[] =
 {
@@ -418,6 +435,19 @@ fsp_err_t R_GLCDC_Open (display_ctrl_t * const p_api_ctrl, display_cfg_t const *
     p_ctrl->p_cfg        = p_cfg;             /// Save user configuration
     g_ctrl_blk.p_context = p_ctrl;            /// Save the display interface context into GLCDC HAL control block
 
+    /* Reset the flip queue. The buffers from the configuration are scanned out until the first flip. */
+    for (uint32_t layer = 0U; layer <= DISPLAY_FRAME_LAYER_2; layer++)
+    {
+        g_flip_head[layer]      = 0U;
+        g_flip_tail[layer]      = 0U;
+        g_flip_pending[layer]   = NULL;
+        g_flip_displayed[layer] = (uint8_t *) p_cfg->input[layer].p_base;
+    }
+
+    g_flip_stats    = (glcdc_flip_stats_t) {0U};
+    g_flip_callback = NULL;
+    g_flip_context  = NULL;
+
     /* Set the line number to trigger the line detect interrupt */
     R_GLCDC->GR[1].CLUTINT_b.LINE = (uint16_t) (p_cfg->output.vtiming.back_porch +
                                                 p_cfg->output.vtiming.display_cyc +
@@ -893,6 +923,107 @@ fsp_err_t R_GLCDC_StatusGet (display_ctrl_t const * const p_api_ctrl, display_st
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Set the callback that returns frame buffers released by the flip queue to the renderer. The callback is called
+ * from the line detect interrupt once the frame buffer replaced by a queued flip is no longer scanned out.
+ *
+ * @retval  FSP_SUCCESS                      Callback set.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                 The driver is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_GLCDC_FlipCallbackSet (display_ctrl_t * const p_api_ctrl,
+                                   void (                 * p_callback)(glcdc_flip_callback_args_t *),
+                                   void * const           p_context)
+{
+    glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+#if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_flip_callback = p_callback;
+    g_flip_context  = p_context;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queue a frame buffer for a layer. Queued frame buffers are committed one per frame at the line detect interrupt,
+ * so each of them is scanned out for at least one full frame without tearing. With a queue depth of 2 or more, the
+ * renderer can draw into a third buffer while two completed frames wait for their Vsync.
+ *
+ * Do not use @ref R_GLCDC_BufferChange on a layer that is flipped through the queue.
+ *
+ * @retval  FSP_SUCCESS                      Frame buffer queued.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block or frame buffer is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                 The driver is not open.
+ * @retval  FSP_ERR_INVALID_ARGUMENT         The layer is not a graphics layer.
+ * @retval  FSP_ERR_INVALID_ALIGNMENT        The framebuffer pointer is not 64-byte aligned.
+ * @retval  FSP_ERR_IRQ_BSP_DISABLED         The line detect interrupt, which commits queued frame buffers, is not
+ *                                           enabled.
+ * @retval  FSP_ERR_INSUFFICIENT_SPACE       GLCDC_CFG_FLIP_QUEUE_DEPTH frame buffers are already queued.
+ **********************************************************************************************************************/
+fsp_err_t R_GLCDC_FlipQueue (display_ctrl_t * const p_api_ctrl,
+                             uint8_t * const        framebuffer,
+                             display_frame_layer_t  layer)
+{
+    glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
+
+#if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(framebuffer);
+    FSP_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(layer <= DISPLAY_FRAME_LAYER_2, FSP_ERR_INVALID_ARGUMENT);
+
+    /* Buffer address must be aligned to 64-byte boundary */
+    FSP_ERROR_RETURN(0U == (((uint32_t) framebuffer) % GLCDC_PRV_ADDRESS_ALIGNMENT_64B), FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    /* Queued frame buffers are only committed by the line detect interrupt */
+    FSP_ERROR_RETURN(p_ctrl->p_cfg->line_detect_irq >= 0, FSP_ERR_IRQ_BSP_DISABLED);
+
+    uint32_t head = g_flip_head[layer];
+    FSP_ERROR_RETURN((head - g_flip_tail[layer]) < GLCDC_CFG_FLIP_QUEUE_DEPTH, FSP_ERR_INSUFFICIENT_SPACE);
+
+    /* Store the entry before publishing it to the line detect interrupt */
+    g_flip_queue[layer][head % GLCDC_CFG_FLIP_QUEUE_DEPTH] = framebuffer;
+    __DMB();
+    g_flip_head[layer] = head + 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Get the flip queue statistics accumulated since R_GLCDC_Open.
+ *
+ * @retval  FSP_SUCCESS                      Statistics stored in p_stats.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block or p_stats is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                 The driver is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_GLCDC_FlipStatsGet (display_ctrl_t * const p_api_ctrl, glcdc_flip_stats_t * const p_stats)
+{
+    glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+#if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_stats);
+    FSP_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats = g_flip_stats;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
 /* @} (end addtogroup GLCDC) */
 
 /***********************************************************************************************************************
@@ -1910,6 +2041,9 @@ void glcdc_line_detect_isr (void)
     g_clut_data_latched[0] = true;
     g_clut_data_latched[1] = true;
 
+    /* Release the buffers replaced at the last Vsync and commit the next queued buffers */
+    r_glcdc_flip_process();
+
     /* Call back callback function if it is registered */
     if (NULL != p_ctrl->p_callback)
     {
@@ -1941,6 +2075,8 @@ void glcdc_underflow_1_isr (void)
     display_callback_args_t args;
     glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) g_ctrl_blk.p_context;
 
+    g_flip_stats.underflows[0]++;
+
     /* Call back callback function if it is registered */
     if (NULL != p_ctrl->p_callback)
     {
@@ -1972,6 +2108,8 @@ void glcdc_underflow_2_isr (void)
     display_callback_args_t args;
     glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) g_ctrl_blk.p_context;
 
+    g_flip_stats.underflows[1]++;
+
     /* Call the callback function if it is registered */
     if (NULL != p_ctrl->p_callback)
     {
@@ -1989,6 +2127,76 @@ void glcdc_underflow_2_isr (void)
     FSP_CONTEXT_RESTORE
 }
 
+/*******************************************************************************************************************//**
+ * Advance the flip queue of each layer. Called from the line detect interrupt, which occurs after the last displayed
+ * line and before the Vsync that reflects the graphics registers.
+ *           A buffer committed at the previous line detect interrupt has been scanned out since the last Vsync, so
+ *           the buffer it replaced is released to the flip callback. The next queued buffer is then committed so it
+ *           is scanned out from the next Vsync.
+ * @retval        none
+ **********************************************************************************************************************/
+static void r_glcdc_flip_process (void)
+{
+    for (uint32_t layer = 0U; layer <= DISPLAY_FRAME_LAYER_2; layer++)
+    {
+        /* The register update requested at the last commit is cleared by hardware once it is reflected */
+        bool updating = (bool) R_GLCDC->GR[layer].VEN_b.PVEN;
+
+        if (NULL != g_flip_pending[layer])
+        {
+            if (updating)
+            {
+                g_flip_stats.missed_flips++;
+                continue;
+            }
+
+            glcdc_flip_callback_args_t args;
+            args.layer              = (display_frame_layer_t) layer;
+            args.p_released         = g_flip_displayed[layer];
+            args.p_displayed        = g_flip_pending[layer];
+            args.p_context          = g_flip_context;
+            g_flip_displayed[layer] = g_flip_pending[layer];
+            g_flip_pending[layer]   = NULL;
+            g_flip_stats.flips++;
+
+            if (NULL != g_flip_callback)
+            {
+                g_flip_callback(&args);
+            }
+        }
+
+        uint32_t tail = g_flip_tail[layer];
+        if (tail == g_flip_head[layer])
+        {
+            /* Only layers that have been flipped through the queue report repeated frames */
+            if (0U != tail)
+            {
+                g_flip_stats.repeated_frames++;
+            }
+
+            continue;
+        }
+
+        /* An update requested through another API has not been reflected yet, keep the buffer queued */
+        if (updating || (bool) R_GLCDC->BG.EN_b.VEN)
+        {
+            g_flip_stats.missed_flips++;
+            continue;
+        }
+
+        uint8_t * framebuffer = g_flip_queue[layer][tail % GLCDC_CFG_FLIP_QUEUE_DEPTH];
+        g_flip_tail[layer] = tail + 1U;
+
+        R_GLCDC->GR[layer].AB1_b.DISPSEL = GLCDC_PLANE_BLEND_ON_LOWER_LAYER & GLCDC_PRV_GR_AB1_DISPSEL_MASK;
+        R_GLCDC->GR[layer].FLMRD         = 1U;
+        R_GLCDC->GR[layer].FLM2          = (uint32_t) framebuffer;
+
+        /* Reflect the shadow registers on the next Vsync */
+        R_GLCDC->GR[layer].VEN_b.PVEN = 1U;
+        g_flip_pending[layer]         = framebuffer;
+    }
+}
+
 /*******************************************************************************************************************//**
  * Enable the glcdc interrupt.
  * @param[in]     p_instance_ctrl   Pointer to GLCDC instance struct
@@ -26,6 +26,7 @@ typedef enum e_i3c_internal_state
     I3C_INTERNAL_STATE_MASTER_READ          = I3C_EVENT_READ_COMPLETE,
     I3C_INTERNAL_STATE_MASTER_COMMAND_WRITE = I3C_EVENT_COMMAND_COMPLETE,
     I3C_INTERNAL_STATE_MASTER_COMMAND_READ  = (I3C_EVENT_COMMAND_COMPLETE | (0x80U)),
+    I3C_INTERNAL_STATE_MASTER_TRANSFER_LIST = I3C_EVENT_TRANSFER_LIST_COMPLETE,
     I3C_INTERNAL_STATE_SLAVE_IDLE,
     I3C_INTERNAL_STATE_SLAVE_IBI = I3C_EVENT_IBI_WRITE_COMPLETE,
 } i3c_internal_state_t;
@@ -147,6 +148,11 @@ static uint8_t i3c_address_parity(uint8_t address);
 
 #if I3C_CFG_MASTER_SUPPORT
 static uint32_t i3c_xfer_command_calculate(uint32_t dev_index, bool rnw, uint32_t bitrate_setting, bool restart);
+static void     i3c_transfer_list_next_start(i3c_instance_ctrl_t * p_ctrl);
+static bool     i3c_ibi_ring_commit(i3c_instance_ctrl_t * p_ctrl,
+                                    i3c_ibi_ring_t      * p_ring,
+                                    uint8_t               address,
+                                    uint32_t              err_status);
 
 #endif
 static void i3c_fifo_read(i3c_instance_ctrl_t * p_ctrl, uint32_t bytes);
@@ -1366,6 +1372,202 @@ fsp_err_t R_I3C_IbiRead (i3c_ctrl_t * const p_api_ctrl, uint8_t * const p_data,
 #endif
 }
 
+/*******************************************************************************************************************//**
+ * Start a list of read and write transfers to one or more devices (This function is only used in master mode).
+ *
+ * Each transfer is started from the Response Status Queue Full IRQ as soon as the previous one completes, and
+ * consecutive transfers are separated by a repeated-start. A stop condition is issued after the last transfer. The
+ * application is notified once with I3C_EVENT_TRANSFER_LIST_COMPLETE when all transfers have completed, or when a
+ * transfer fails. i3c_callback_args_t::transfer_size provides the number of transfers that were completed, and
+ * i3c_transfer_descriptor_t::transfer_size and i3c_transfer_descriptor_t::event_status are updated for each of them.
+ *
+ * Transfers with the bitrate mode set to I3C_BITRATE_MODE_I3C_HDR_DDR_STDBR are sent as HDR-DDR commands using
+ * i3c_transfer_descriptor_t::command_code.
+ *
+ * The transfer list must remain valid until I3C_EVENT_TRANSFER_LIST_COMPLETE is received.
+ *
+ * @retval FSP_SUCCESS                    The first transfer was started.
+ * @retval FSP_ERR_ASSERTION              An argument was NULL or invalid.
+ * @retval FSP_ERR_NOT_OPEN               This instance has not been opened yet.
+ * @retval FSP_ERR_IN_USE                 The operation could not be completed because the driver is busy.
+ * @retval FSP_ERR_INVALID_MODE           This driver is not in master mode, or HDR-DDR is not supported on this MCU.
+ * @retval FSP_ERR_INVALID_ALIGNMENT      A buffer is not aligned to 4 bytes, or an HDR-DDR transfer length is not a
+ *                                        multiple of 2 bytes.
+ * @retval FSP_ERR_UNSUPPORTED            Master support is disabled.
+ **********************************************************************************************************************/
+fsp_err_t R_I3C_TransferListStart (i3c_ctrl_t * const                p_api_ctrl,
+                                   i3c_transfer_descriptor_t * const p_transfers,
+                                   uint32_t                          count)
+{
+#if I3C_CFG_MASTER_SUPPORT
+    i3c_instance_ctrl_t * p_ctrl = (i3c_instance_ctrl_t *) p_api_ctrl;
+
+ #if I3C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_api_ctrl);
+    FSP_ERROR_RETURN(I3C_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_transfers);
+    FSP_ASSERT(0U != count);
+    FSP_ERROR_RETURN(
+        I3C_INTERNAL_STATE_SLAVE_IDLE != p_ctrl->internal_state && I3C_INTERNAL_STATE_DISABLED != p_ctrl->internal_state,
+        FSP_ERR_INVALID_MODE);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        FSP_ASSERT(NULL != p_transfers[i].p_buffer);
+        FSP_ASSERT(BSP_FEATURE_I3C_MAX_DEV_COUNT > p_transfers[i].device_index ||
+                   I3C_DEVICE_INDEX_EXTENDED_DEVICE == p_transfers[i].device_index);
+
+  #if !I3C_CFG_UNALIGNED_BUFFER_SUPPORT
+
+        /* Verify that the buffer is aligned to 4 bytes. */
+        FSP_ERROR_RETURN(0U == ((uint32_t) p_transfers[i].p_buffer & 0x03U), FSP_ERR_INVALID_ALIGNMENT);
+  #endif
+
+        if (I3C_BITRATE_MODE_I3C_HDR_DDR_STDBR == p_transfers[i].bitrate_mode)
+        {
+  #if BSP_FEATURE_I3C_HAS_HDR_MODE
+
+            /* Verify that length is a multiple of 2 in HDR modes. */
+            FSP_ERROR_RETURN(p_transfers[i].length % 2 == 0, FSP_ERR_INVALID_ALIGNMENT);
+  #else
+
+            return FSP_ERR_INVALID_MODE;
+  #endif
+        }
+        else
+        {
+            FSP_ASSERT(I3C_BITRATE_MODE_I3C_SDR4_EXTBR_X4 >= p_transfers[i].bitrate_mode);
+        }
+    }
+ #endif
+
+    /* Ensure that driver is in the idle state. */
+    FSP_ERROR_RETURN(I3C_INTERNAL_STATE_MASTER_IDLE == p_ctrl->internal_state, FSP_ERR_IN_USE);
+
+    p_ctrl->p_transfer_list     = p_transfers;
+    p_ctrl->transfer_list_count = count;
+    p_ctrl->transfer_list_index = 0;
+
+    i3c_transfer_list_next_start(p_ctrl);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_transfers);
+    FSP_PARAMETER_NOT_USED(count);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Capture received IBIs into a ring instead of the buffer provided by @ref i3c_api_t::ibiRead (This function is only
+ * used in master mode).
+ *
+ * For each IBI Interrupt request, the driver stores the address of the device, the payload and a timestamp in the next
+ * entry of the ring. I3C_EVENT_IBI_READ_COMPLETE is only issued when an IBI is added to an empty ring, so the
+ * application must drain the ring with @ref R_I3C_IbiRingRead until FSP_ERR_BUFFER_EMPTY is returned. If the ring is
+ * full, the IBI is discarded and i3c_ibi_ring_t::overflow_count is incremented. Hot-Join and Mastership requests do
+ * not consume ring entries; they are still read into the buffer provided by @ref i3c_api_t::ibiRead and reported
+ * through the callback.
+ *
+ * @param[in]  p_api_ctrl             Pointer to an instance's control structure.
+ * @param[in]  p_ring                 Ring to capture IBIs into. The head, tail and counters are reset. Set to NULL to
+ *                                    stop capturing IBIs into a ring.
+ *
+ * @retval FSP_SUCCESS                    Ring configured successfully.
+ * @retval FSP_ERR_ASSERTION              An argument was NULL, or the number of entries is not a power of 2.
+ * @retval FSP_ERR_NOT_OPEN               This instance has not been opened yet.
+ * @retval FSP_ERR_INVALID_MODE           This function is only called in master mode.
+ * @retval FSP_ERR_UNSUPPORTED            Master support is disabled.
+ **********************************************************************************************************************/
+fsp_err_t R_I3C_IbiRingSet (i3c_ctrl_t * const p_api_ctrl, i3c_ibi_ring_t * const p_ring)
+{
+#if I3C_CFG_MASTER_SUPPORT
+    i3c_instance_ctrl_t * p_ctrl = (i3c_instance_ctrl_t *) p_api_ctrl;
+
+ #if I3C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_api_ctrl);
+    FSP_ERROR_RETURN(I3C_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    if (NULL != p_ring)
+    {
+        FSP_ASSERT(NULL != p_ring->p_entries);
+
+        /* The number of entries must be a power of 2 so that the free running head and tail can be masked. */
+        FSP_ASSERT(0U != p_ring->num_entries);
+        FSP_ASSERT(0U == (p_ring->num_entries & (p_ring->num_entries - 1U)));
+    }
+
+    /* This function is not used in slave mode. */
+    FSP_ERROR_RETURN(I3C_INTERNAL_STATE_SLAVE_IDLE != p_ctrl->internal_state &&
+                     I3C_INTERNAL_STATE_SLAVE_IBI != p_ctrl->internal_state &&
+                     I3C_INTERNAL_STATE_DISABLED != p_ctrl->internal_state,
+                     FSP_ERR_INVALID_MODE);
+ #endif
+
+    i3c_extended_cfg_t const * p_extend = (i3c_extended_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+    /* Disable the IBI IRQ in order to ensure that updating the IBI ring is not interrupted. */
+    R_BSP_IrqDisable(p_extend->ibi_irq);
+
+    if (NULL != p_ring)
+    {
+        p_ring->head            = 0U;
+        p_ring->tail            = 0U;
+        p_ring->overflow_count  = 0U;
+        p_ring->truncated_count = 0U;
+    }
+
+    p_ctrl->p_ibi_ring       = p_ring;
+    p_ctrl->ibi_ring_discard = false;
+
+    R_BSP_IrqEnableNoClear(p_extend->ibi_irq);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_ring);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Copy the oldest IBI out of a ring configured with @ref R_I3C_IbiRingSet and release its entry. This function does
+ * not disable interrupts and may be called while IBIs are being received, but it must only be called from one context
+ * at a time.
+ *
+ * @param[in]  p_ring                 Ring to read from.
+ * @param[out] p_entry                The oldest IBI in the ring.
+ *
+ * @retval FSP_SUCCESS                    An IBI was read from the ring.
+ * @retval FSP_ERR_ASSERTION              An argument was NULL.
+ * @retval FSP_ERR_BUFFER_EMPTY           The ring is empty.
+ **********************************************************************************************************************/
+fsp_err_t R_I3C_IbiRingRead (i3c_ibi_ring_t * const p_ring, i3c_ibi_ring_entry_t * const p_entry)
+{
+#if I3C_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ring);
+    FSP_ASSERT(NULL != p_entry);
+#endif
+
+    uint32_t tail = p_ring->tail;
+
+    FSP_ERROR_RETURN(p_ring->head != tail, FSP_ERR_BUFFER_EMPTY);
+
+    /* Ensure that the entry is read after the head that published it. */
+    __DMB();
+
+    *p_entry = p_ring->p_entries[tail & (p_ring->num_entries - 1U)];
+
+    /* Ensure that the entry has been copied before it is released to the driver. */
+    __DMB();
+
+    p_ring->tail = tail + 1U;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Close the I3C instance. Implements @ref i3c_api_t::close.
  *
@@ -1472,6 +1674,146 @@ static uint32_t i3c_xfer_command_calculate (uint32_t dev_index, bool rnw, uint32
     return command_descriptor;
 }
 
+/*******************************************************************************************************************//**
+ * Start the transfer at the current index of the transfer list. All transfers except the last one are terminated with
+ * a repeated-start condition.
+ *
+ * @param[in]  p_ctrl                Pointer to an instance's control structure.
+ **********************************************************************************************************************/
+static void i3c_transfer_list_next_start (i3c_instance_ctrl_t * p_ctrl)
+{
+    i3c_transfer_descriptor_t const * p_transfer = &p_ctrl->p_transfer_list[p_ctrl->transfer_list_index];
+
+    bool     restart = (p_ctrl->transfer_list_index + 1U) < p_ctrl->transfer_list_count;
+    uint32_t cmd1    = i3c_xfer_command_calculate(p_transfer->device_index,
+                                                  p_transfer->rnw,
+                                                  p_transfer->bitrate_mode,
+                                                  restart);
+    uint32_t cmd2;
+
+    if (I3C_BITRATE_MODE_I3C_HDR_DDR_STDBR == p_transfer->bitrate_mode)
+    {
+        /* HDR-DDR transfers are sent as HDR commands (See "Command Descriptor" in the I3C section of the relevant
+         * hardware manual). */
+        cmd1 |= (uint32_t) (p_transfer->command_code << I3C_CMD_DESC_CMD_Pos);
+        cmd1 |= I3C_CMD_DESC_XFER_CP_Msk;
+    }
+
+    p_ctrl->internal_state = I3C_INTERNAL_STATE_MASTER_TRANSFER_LIST;
+
+    if (p_transfer->rnw)
+    {
+        i3c_extended_cfg_t const * p_extend = (i3c_extended_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+        /* Disable the Receive Buffer Full IRQ in order to ensure that updating the read buffer state is not
+         * interrupted. */
+        R_BSP_IrqDisable(p_extend->rx_irq);
+
+        p_ctrl->read_buffer_descriptor.count               = 0;
+        p_ctrl->read_buffer_descriptor.buffer_size         = p_transfer->length;
+        p_ctrl->read_buffer_descriptor.p_buffer            = p_transfer->p_buffer;
+        p_ctrl->read_buffer_descriptor.read_request_issued = false;
+
+        R_BSP_IrqEnableNoClear(p_extend->rx_irq);
+
+        cmd2 = (p_transfer->length << I3C_CMD_DESC_XFER_LENGTH_Pos) & I3C_CMD_DESC_XFER_LENGTH_Msk;
+    }
+    else
+    {
+        p_ctrl->write_buffer_descriptor.count       = 0;
+        p_ctrl->write_buffer_descriptor.buffer_size = p_transfer->length;
+        p_ctrl->write_buffer_descriptor.p_buffer    = p_transfer->p_buffer;
+
+        /* Calculate the next data word that will be written to the FIFO. */
+        p_ctrl->next_word = i3c_next_data_word_calculate(&p_ctrl->write_buffer_descriptor);
+
+        if (p_transfer->length <= 4)
+        {
+            /* If the transfer length is less than or equal to 4 bytes, then use "Immediate Data Transfer".
+             * See section "Immediate Transfer Command" in the I3C section of the relevant hardware manual. */
+            cmd1 |= I3C_CMD_DESC_CND_ATTR_IMMED_DATA_XFER;
+            cmd1 |= (p_transfer->length << I3C_CMD_DESC_IMMED_DATA_XFER_BYTE_CNT_Pos);
+            cmd2  = p_ctrl->next_word;
+            p_ctrl->write_buffer_descriptor.count = p_transfer->length;
+        }
+        else
+        {
+            /* Write data to the FIFO. */
+            i3c_fifo_write(p_ctrl);
+
+            /* If there is still data remaining in the transfer then it will be written in the Write Buffer Empty IRQ. */
+            if ((BSP_FEATURE_I3C_NTDTBP0_DEPTH * sizeof(uint32_t)) < p_transfer->length)
+            {
+                /* Enable the Write Buffer Empty IRQ. */
+                p_ctrl->p_reg->NTIE_b.TDBEIE0 = 1;
+            }
+
+            cmd2 = (p_transfer->length << I3C_CMD_DESC_XFER_LENGTH_Pos) & I3C_CMD_DESC_XFER_LENGTH_Msk;
+        }
+    }
+
+    /*
+     * Write the descriptor to the command queue.
+     * Note that the command descriptor is two words. The least significant word must be written first followed by
+     * the most significant word (See section "Command Descriptor" in the I3C Operation section of the relevant hardware manual).
+     */
+    p_ctrl->p_reg->NCMDQP = cmd1;
+    p_ctrl->p_reg->NCMDQP = cmd2;
+
+    /* Clear the command queue empty flag. */
+    p_ctrl->p_reg->NTST_b.CMDQEF = 0;
+}
+
+/*******************************************************************************************************************//**
+ * Complete the entry at the head of the IBI ring and make it visible to the application.
+ *
+ * @param[in]  p_ctrl                Pointer to an instance's control structure.
+ * @param[in]  p_ring                Pointer to the IBI ring.
+ * @param[in]  address               Address of the device that sent the IBI.
+ * @param[in]  err_status            Status of the IBI transfer.
+ *
+ * @retval     true                  The ring was empty before this IBI was added, so the application must be notified.
+ * @retval     false                 The ring already contained IBIs, or the IBI was discarded.
+ **********************************************************************************************************************/
+static bool i3c_ibi_ring_commit (i3c_instance_ctrl_t * p_ctrl,
+                                 i3c_ibi_ring_t      * p_ring,
+                                 uint8_t               address,
+                                 uint32_t              err_status)
+{
+    if (p_ctrl->ibi_ring_discard)
+    {
+        p_ctrl->ibi_ring_discard = false;
+        p_ring->overflow_count++;
+
+        return false;
+    }
+
+    uint32_t               head    = p_ring->head;
+    uint32_t               length  = p_ctrl->ibi_transfer_count_final;
+    i3c_ibi_ring_entry_t * p_entry = &p_ring->p_entries[head & (p_ring->num_entries - 1U)];
+
+    if (length > I3C_CFG_IBI_RING_PAYLOAD_SIZE)
+    {
+        p_ring->truncated_count++;
+        length = I3C_CFG_IBI_RING_PAYLOAD_SIZE;
+    }
+
+    p_entry->timestamp      = (NULL != p_ring->p_timestamp_get) ? p_ring->p_timestamp_get() : 0U;
+    p_entry->address        = address;
+    p_entry->mandatory_byte = (length > 0U) ? p_entry->payload[0] : 0U;
+    p_entry->length         = (uint8_t) length;
+    p_entry->event_status   = (uint8_t) err_status;
+
+    bool was_empty = (head == p_ring->tail);
+
+    /* Ensure that the entry is written before it is published by advancing the head. */
+    __DMB();
+
+    p_ring->head = head + 1U;
+
+    return was_empty;
+}
+
 #endif
 
 /*******************************************************************************************************************//**
@@ -1706,6 +2048,9 @@ void i3c_resp_isr (void)
                           I3C_RESP_STATUS_DESC_ERR_STATUS_Pos;
 
     bool error_recovery_case_2 = false;
+#if I3C_CFG_MASTER_SUPPORT
+    bool transfer_list_continue = false;
+#endif
 
     uint32_t internal_state = p_ctrl->internal_state;
 
@@ -1808,6 +2153,66 @@ void i3c_resp_isr (void)
             p_ctrl->current_command_code = 0;
             break;
         }
+
+        case I3C_INTERNAL_STATE_MASTER_TRANSFER_LIST:
+        {
+            i3c_transfer_descriptor_t * p_transfer = &p_ctrl->p_transfer_list[p_ctrl->transfer_list_index];
+
+            if (p_transfer->rnw)
+            {
+                uint32_t bytes_remaining = i3c_read_bytes_remaining_calculate(p_ctrl, data_length);
+
+                /* Read the remaining byte stored in the FIFO. */
+                i3c_fifo_read(p_ctrl, bytes_remaining);
+
+ #if I3C_ERROR_RECOVERY_VERSION_1 == I3C_CFG_ERROR_RECOVERY_SUPPORT || \
+                I3C_ERROR_RECOVERY_VERSION_BOTH == I3C_CFG_ERROR_RECOVERY_SUPPORT
+  #if I3C_ERROR_RECOVERY_VERSION_BOTH == I3C_CFG_ERROR_RECOVERY_SUPPORT
+                if (1U == I3C_A2E2_VERSION)
+  #endif
+                {
+                    /* Error recovery is required if the transfer length is less than expected (See
+                     * I3C_INTERNAL_STATE_MASTER_READ). */
+                    if (data_length != p_ctrl->read_buffer_descriptor.buffer_size)
+                    {
+                        error_recovery_case_2 = true;
+                    }
+                }
+ #endif
+
+                /* For a read transfer, DATA_LENGTH provides the total number of bytes read. */
+                p_transfer->transfer_size = data_length;
+
+                p_ctrl->read_buffer_descriptor = (i3c_read_buffer_descriptor_t) {
+                    0
+                };
+            }
+            else
+            {
+                /* For a write transfer, DATA_LENGTH provides the number of bytes remaining. */
+                p_transfer->transfer_size = p_ctrl->write_buffer_descriptor.buffer_size - data_length;
+
+                p_ctrl->write_buffer_descriptor = (i3c_write_buffer_descriptor_t) {
+                    0
+                };
+
+                /* Disable the transmit IRQ if it hasn't been disabled already. */
+                p_ctrl->p_reg->NTIE_b.TDBEIE0 = 0;
+                i3c_extended_cfg_t * p_extend = (i3c_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+                R_BSP_IrqClearPending(p_extend->tx_irq);
+            }
+
+            p_transfer->event_status = err_status;
+            p_ctrl->transfer_list_index++;
+
+            /* Start the next transfer without notifying the application, unless this transfer failed. */
+            transfer_list_continue = (I3C_EVENT_STATUS_SUCCESS == err_status) && !error_recovery_case_2 &&
+                                     (p_ctrl->transfer_list_index < p_ctrl->transfer_list_count);
+
+            /* For a transfer list, the transfer size is the number of transfers that were completed. */
+            callback_args.transfer_size = p_ctrl->transfer_list_index;
+            break;
+        }
 #endif
 
 #if I3C_CFG_SLAVE_SUPPORT
@@ -1866,8 +2271,18 @@ void i3c_resp_isr (void)
     /* Clear error status flags. */
     p_ctrl->p_reg->NTST &= ~(R_I3C0_NTST_TEF_Msk | R_I3C0_NTST_TABTF_Msk);
 
-    /* Notify the application of the event. */
-    p_ctrl->p_cfg->p_callback(&callback_args);
+#if I3C_CFG_MASTER_SUPPORT
+    if (transfer_list_continue && (0 == (ntst & (R_I3C0_NTST_TEF_Msk | R_I3C0_NTST_TABTF_Msk))))
+    {
+        /* Start the next transfer in the list. */
+        i3c_transfer_list_next_start(p_ctrl);
+    }
+    else
+#endif
+    {
+        /* Notify the application of the event. */
+        p_ctrl->p_cfg->p_callback(&callback_args);
+    }
 
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
@@ -2171,26 +2586,79 @@ void i3c_ibi_isr (void)
         /* Get the number of bytes following the status descriptor. */
         uint32_t ibi_data_length = (ibi_status & I3C_IBI_STATUS_DESC_LENGTH_Msk) >> I3C_IBI_STATUS_DESC_LENGTH_Pos;
 
+        /* Offset of the data following this status descriptor in the IBI payload. */
+        uint32_t ibi_offset = p_ctrl->ibi_transfer_count_final;
+
         /* Update the total number of bytes read during the IBI transfer. */
         p_ctrl->ibi_transfer_count_final += ibi_data_length;
 
         /* Calculate the number of words that need to be read from the IBI Queue. */
         uint32_t ibi_data_length_w = (ibi_data_length + sizeof(uint32_t) - 1) / sizeof(uint32_t);
 
+        /* Get the address of the IBI transfer. Every status descriptor of an IBI carries the same IBI ID, so the
+         * address is decoded from each descriptor as it is read. The entry is committed with the address of the last
+         * descriptor. */
+        uint8_t ibi_address = (ibi_status & I3C_IBI_STATUS_DESC_IBI_ID_Msk) >>
+                              (I3C_IBI_STATUS_DESC_IBI_ID_Pos + 1);
+
+        /* Get the RNW bit of the IBI transfer. */
+        uint8_t ibi_rnw = (ibi_status >> I3C_IBI_STATUS_DESC_IBI_ID_Pos) & 1U;
+
+        /* Only IBI Interrupt requests are captured in the ring. Hot-Join and Mastership requests never use an entry. */
+        i3c_ibi_ring_t * p_ring = p_ctrl->p_ibi_ring;
+        if ((I3C_HOT_JOIN_ADDRESS == ibi_address) || (0U == ibi_rnw))
+        {
+            p_ring = NULL;
+        }
+
+        if ((NULL != p_ring) && (0U == ibi_offset))
+        {
+            /* At the start of an IBI, discard the IBI if there is no free entry in the ring. */
+            p_ctrl->ibi_ring_discard = (p_ring->head - p_ring->tail) >= p_ring->num_entries;
+        }
+
         for (uint32_t i = 0; i < ibi_data_length_w; i++)
         {
             /* Get the next word of data from the IBI Queue. */
             uint32_t read_data = p_ctrl->p_reg->NIBIQP;
 
-            /*
-             * Store the next word of data into the read buffer. If there is not enough space, a I3C_EVENT_IBI_READ_BUFFER_FULL
-             * event will be called to notify the application that a new read buffer is required.
-             */
-            i3c_read_buffer_store(p_ctrl,
-                                  &p_ctrl->ibi_buffer_descriptor,
-                                  read_data,
-                                  ibi_data_length,
-                                  I3C_EVENT_IBI_READ_BUFFER_FULL);
+            if (NULL != p_ring)
+            {
+                /* Store the data in the entry at the head of the ring. The entry is not visible to the application
+                 * until the head is advanced at the end of the IBI. */
+                if (!p_ctrl->ibi_ring_discard && (ibi_offset < I3C_CFG_IBI_RING_PAYLOAD_SIZE))
+                {
+                    i3c_ibi_ring_entry_t * p_entry = &p_ring->p_entries[p_ring->head & (p_ring->num_entries - 1U)];
+
+                    if ((0U == (ibi_offset & 3U)) && ((ibi_offset + 4U) <= I3C_CFG_IBI_RING_PAYLOAD_SIZE))
+                    {
+                        *((uint32_t *) &p_entry->payload[ibi_offset]) = read_data;
+                    }
+                    else
+                    {
+                        /* Store the bytes that fit one at a time so that the payload is never overrun. */
+                        for (uint32_t j = 0U; (j < 4U) && ((ibi_offset + j) < I3C_CFG_IBI_RING_PAYLOAD_SIZE); j++)
+                        {
+                            p_entry->payload[ibi_offset + j] = (uint8_t) (read_data >> (8U * j));
+                        }
+                    }
+                }
+
+                ibi_offset += 4;
+            }
+            else
+            {
+                /*
+                 * Store the next word of data into the read buffer. If there is not enough space, a I3C_EVENT_IBI_READ_BUFFER_FULL
+                 * event will be called to notify the application that a new read buffer is required.
+                 */
+                i3c_read_buffer_store(p_ctrl,
+                                      &p_ctrl->ibi_buffer_descriptor,
+                                      read_data,
+                                      ibi_data_length,
+                                      I3C_EVENT_IBI_READ_BUFFER_FULL);
+            }
+
             ibi_data_length -= 4;
         }
 
@@ -2200,13 +2668,6 @@ void i3c_ibi_isr (void)
         /* If this is the last IBI status descriptor, then the IBI transfer is completed. */
         if (0U != (I3C_IBI_STATUS_DESC_LAST_STATUS_Msk & ibi_status))
         {
-            /* Get the address of the IBI transfer. */
-            uint8_t ibi_address = (ibi_status & I3C_IBI_STATUS_DESC_IBI_ID_Msk) >>
-                                  (I3C_IBI_STATUS_DESC_IBI_ID_Pos + 1);
-
-            /* Get the RNW bit of the IBI transfer. */
-            uint8_t ibi_rnw = (ibi_status >> I3C_IBI_STATUS_DESC_IBI_ID_Pos) & 1U;
-
             uint32_t err_status =
                 (ibi_status & (I3C_IBI_STATUS_DESC_IBI_ST_Msk | I3C_IBI_STATUS_DESC_ERR_STATUS_Msk)) >>
                 I3C_IBI_STATUS_DESC_ERR_STATUS_Pos;
@@ -2233,13 +2694,22 @@ void i3c_ibi_isr (void)
                 /* IBI type is I3C_IBI_TYPE_INTERRUPT. */
             }
 
+            bool notify = true;
+            if (NULL != p_ring)
+            {
+                notify = i3c_ibi_ring_commit(p_ctrl, p_ring, ibi_address, err_status);
+            }
+
             p_ctrl->ibi_buffer_descriptor = (i3c_read_buffer_descriptor_t) {
                 0
             };
             p_ctrl->ibi_transfer_count_final = 0;
 
-            /* Notify the application of the event. */
-            p_ctrl->p_cfg->p_callback(&callback_args);
+            if (notify)
+            {
+                /* Notify the application of the event. */
+                p_ctrl->p_cfg->p_callback(&callback_args);
+            }
         }
 #endif
     }
@@ -140,6 +140,46 @@
  * Global Typedef definitions
  *********************************************************************************************************************/
 
+/* Authenticated cipher used by an AES session */
+typedef enum e_hw_sce_aes_session_mode
+{
+    HW_SCE_AES_SESSION_MODE_GCM = 0,   /*!< AES-GCM                                                                    */
+    HW_SCE_AES_SESSION_MODE_CCM = 1,   /*!< AES-CCM                                                                    */
+} hw_sce_aes_session_mode_t;
+
+/* Progress of an AES session */
+typedef enum e_hw_sce_aes_session_state
+{
+    HW_SCE_AES_SESSION_STATE_CLOSED = 0, /*!< Session not opened                                                       */
+    HW_SCE_AES_SESSION_STATE_IDLE   = 1, /*!< Key set, no message in progress                                         */
+    HW_SCE_AES_SESSION_STATE_ACTIVE = 2, /*!< Message started, owns the AES engine until finished                    */
+} hw_sce_aes_session_state_t;
+
+/* One segment of a scatter-gather list, processed in place */
+typedef struct st_hw_sce_aes_sg
+{
+    uint8_t * p_data;                  /*!< Start of the segment                                                       */
+    uint32_t  length;                  /*!< Length of the segment in bytes                                             */
+} hw_sce_aes_sg_t;
+
+/* AES-GCM/CCM session. The key is kept in the session so that it only has to be written to the engine again when
+ * another session or a one-shot operation has used the engine in between. */
+typedef struct st_hw_sce_aes_session
+{
+    hw_sce_aes_session_state_t state;  /*!< Session state                                                              */
+    hw_sce_aes_session_mode_t  mode;   /*!< GCM or CCM                                                                 */
+    uint32_t key[SIZE_AES_256BIT_KEYLEN_BYTES / 4]; /*!< Plain key                                                    */
+    uint32_t key_len;                  /*!< Key length in bytes                                                        */
+    bool     encrypt;                  /*!< Direction of the message in progress                                       */
+    uint32_t text_len;                 /*!< Payload length of the message in progress                                  */
+    uint32_t processed_len;            /*!< Payload bytes processed so far                                             */
+    uint32_t aad_len;                  /*!< Associated data length of the message in progress                          */
+    uint32_t iv_len;                   /*!< IV (GCM) or nonce (CCM) length of the message in progress                  */
+    uint32_t tag_len;                  /*!< Tag length of the message in progress                                      */
+    bool     first_block;              /*!< GCM: next payload block is the first block input to the engine             */
+    uint32_t j0[SIZE_AES_BLOCK_BYTES / 4]; /*!< GCM: pre-counter block J0                                             */
+} hw_sce_aes_session_t;
+
 /**********************************************************************************************************************
  * External global variables
  *********************************************************************************************************************/
@@ -443,4 +483,22 @@ fsp_err_t HW_SCE_Aes256GcmEncryptInitSubGeneral(uint32_t * InData_KeyType,
                                                 uint32_t * InData_IV,
                                                 uint32_t * InData_SeqNum);
 
+fsp_err_t HW_SCE_AesSessionOpen(hw_sce_aes_session_t    * p_session,
+                                hw_sce_aes_session_mode_t mode,
+                                const uint32_t          * InData_Key,
+                                uint32_t                  key_len);
+fsp_err_t HW_SCE_AesSessionStart(hw_sce_aes_session_t * p_session,
+                                 bool                   encrypt,
+                                 const uint8_t        * InData_IV,
+                                 uint32_t               iv_len,
+                                 const uint8_t        * InData_DataA,
+                                 uint32_t               aad_len,
+                                 uint32_t               text_len,
+                                 uint32_t               tag_len);
+fsp_err_t HW_SCE_AesSessionUpdate(hw_sce_aes_session_t * p_session, hw_sce_aes_sg_t const * p_sg, uint32_t sg_count);
+fsp_err_t HW_SCE_AesSessionFinish(hw_sce_aes_session_t * p_session, uint8_t * InOut_DataT);
+fsp_err_t HW_SCE_AesSessionClose(hw_sce_aes_session_t * p_session);
+void      hw_aes_session_key_invalidate(void);
+bool      hw_aes_session_in_progress(void);
+
 #endif                                 /* HW_SCE_RA_PRIVATE_HEADER_FILE */
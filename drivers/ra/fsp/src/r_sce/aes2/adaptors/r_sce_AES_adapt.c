@@ -89,6 +89,9 @@ void hw_aes_set_key (uint8_t * key, uint32_t KeyLen)
 {
     uint16_t * ptr = (uint16_t *) key;
 
+    /* Any session key held in the engine is overwritten */
+    hw_aes_session_key_invalidate();
+
     if (KeyLen > SIZE_AES_192BIT_KEYLEN_BYTES)
     {
         R_AES_B->AESKEY7.AESKEYH = *ptr;
@@ -286,6 +289,8 @@ fsp_err_t HW_SCE_Aes192EncryptDecryptInitSub (const uint32_t * InData_Cmd,
                                               const uint32_t * InData_KeyIndex,
                                               const uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
 #if RM_TINYCRYPT_PORT_CFG_PARAM_CHECKING_ENABLE
     if ((InData_Cmd == (const uint32_t *) 0) ||
         (InData_KeyIndex == (const uint32_t *) 0) ||
@@ -373,6 +378,8 @@ fsp_err_t HW_SCE_Aes128EncryptDecryptInitSub (const uint32_t * InData_KeyType,
                                               const uint32_t * InData_KeyIndex,
                                               const uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
 #if RM_TINYCRYPT_PORT_CFG_PARAM_CHECKING_ENABLE
     if ((InData_Cmd == (const uint32_t *) 0) ||
@@ -461,6 +468,8 @@ fsp_err_t HW_SCE_Aes256EncryptDecryptInitSub (const uint32_t * InData_KeyType,
                                               const uint32_t * InData_KeyIndex,
                                               const uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
 #if RM_TINYCRYPT_PORT_CFG_PARAM_CHECKING_ENABLE
     if ((InData_Cmd == (const uint32_t *) 0) ||
@@ -546,6 +555,8 @@ fsp_err_t HW_SCE_Aes256EncryptDecryptFinalSub (void)
 
 fsp_err_t HW_SCE_Aes128GcmEncryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_128_ENC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_128BIT_KEYLEN_BYTES);
@@ -581,6 +592,8 @@ fsp_err_t HW_SCE_Aes128GcmEncryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * OutData_Text,
                                            uint32_t * OutData_DataT)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     fsp_err_t status;
     status = hw_gcm_calculation((uint8_t *) InData_Text,
                                 (uint8_t *) OutData_Text,
@@ -596,6 +609,8 @@ fsp_err_t HW_SCE_Aes128GcmEncryptFinalSub (uint32_t * InData_Text,
 
 fsp_err_t HW_SCE_Aes128GcmDecryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_128_DEC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_128BIT_KEYLEN_BYTES);
@@ -632,6 +647,8 @@ fsp_err_t HW_SCE_Aes128GcmDecryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * InData_DataTLen,
                                            uint32_t * OutData_Text)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     uint8_t   Tag[16];
     uint8_t   temp;
     fsp_err_t status;
@@ -677,6 +694,8 @@ fsp_err_t HW_SCE_Aes128GcmDecryptFinalSub (uint32_t * InData_Text,
 
 fsp_err_t HW_SCE_Aes192GcmEncryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_192_ENC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_192BIT_KEYLEN_BYTES);
@@ -712,6 +731,8 @@ fsp_err_t HW_SCE_Aes192GcmEncryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * OutData_Text,
                                            uint32_t * OutData_DataT)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     fsp_err_t status;
     status = hw_gcm_calculation((uint8_t *) InData_Text,
                                 (uint8_t *) OutData_Text,
@@ -727,6 +748,8 @@ fsp_err_t HW_SCE_Aes192GcmEncryptFinalSub (uint32_t * InData_Text,
 
 fsp_err_t HW_SCE_Aes192GcmDecryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_192_DEC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_192BIT_KEYLEN_BYTES);
@@ -763,6 +786,8 @@ fsp_err_t HW_SCE_Aes192GcmDecryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * InData_DataTLen,
                                            uint32_t * OutData_Text)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     uint8_t   Tag[16];
     uint8_t   temp;
     fsp_err_t status;
@@ -808,6 +833,8 @@ fsp_err_t HW_SCE_Aes192GcmDecryptFinalSub (uint32_t * InData_Text,
 
 fsp_err_t HW_SCE_Aes256GcmEncryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_256_ENC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_256BIT_KEYLEN_BYTES);
@@ -843,6 +870,8 @@ fsp_err_t HW_SCE_Aes256GcmEncryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * OutData_Text,
                                            uint32_t * OutData_DataT)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     fsp_err_t status;
     status = hw_gcm_calculation((uint8_t *) InData_Text,
                                 (uint8_t *) OutData_Text,
@@ -858,6 +887,8 @@ fsp_err_t HW_SCE_Aes256GcmEncryptFinalSub (uint32_t * InData_Text,
 
 fsp_err_t HW_SCE_Aes256GcmDecryptInitSub (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     R_AES_B->AESCNTL = R_AES_AESCNTL_GCM_256_DEC;
     hw_aes_set_key((uint8_t *) InData_KeyIndex, SIZE_AES_256BIT_KEYLEN_BYTES);
@@ -894,6 +925,8 @@ fsp_err_t HW_SCE_Aes256GcmDecryptFinalSub (uint32_t * InData_Text,
                                            uint32_t * InData_DataTLen,
                                            uint32_t * OutData_Text)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     uint8_t   Tag[16];
     uint8_t   temp;
     fsp_err_t status;
@@ -947,6 +980,8 @@ fsp_err_t HW_SCE_Aes128CcmEncryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
@@ -982,6 +1017,8 @@ fsp_err_t HW_SCE_Aes192CcmEncryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
@@ -1017,6 +1054,8 @@ fsp_err_t HW_SCE_Aes256CcmEncryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
@@ -1104,6 +1143,8 @@ fsp_err_t HW_SCE_Aes128CcmDecryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
@@ -1153,6 +1194,8 @@ fsp_err_t HW_SCE_Aes192CcmDecryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
@@ -1202,6 +1245,8 @@ fsp_err_t HW_SCE_Aes256CcmDecryptInitSub (const uint32_t InData_KeyType[],
                                           const uint32_t InData_SeqNum[],
                                           const uint32_t Header_Len)
 {
+    FSP_ERROR_RETURN(!hw_aes_session_in_progress(), FSP_ERR_IN_USE);
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
@@ -0,0 +1,611 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+
+#include "bsp_api.h"
+#include "hw_sce_aes_private.h"
+#include "hw_sce_ra_private.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ ***********************************************************************************************************************/
+#define HW_SCE_AES_SESSION_GCM_IV_96BITS_LEN    (12U)
+
+#define HW_SCE_AES_SESSION_CCM_NONCE_MIN_LEN    (7U)
+#define HW_SCE_AES_SESSION_CCM_NONCE_MAX_LEN    (13U)
+#define HW_SCE_AES_SESSION_CCM_TAG_MIN_LEN      (4U)
+
+/***********************************************************************************************************************
+ * Imported global variables and functions
+ ***********************************************************************************************************************/
+extern void HW_SCE_AesCcmEncryptKeyOperation(uint32_t * InData_KeyIndex,
+                                             uint32_t   InData_KeyType,
+                                             uint32_t * InData_IV,
+                                             uint32_t   InData_IVLength);
+extern void HW_SCE_AesCcmEncryptCounterGenerate(uint32_t InData_TextLength,
+                                                uint32_t InData_Hdrlen,
+                                                uint32_t InData_MacLength,
+                                                uint32_t InData_IVLength);
+extern void HW_SCE_AesCcmEncryptInputAssociatedData(uint32_t * InData_Header, uint32_t InData_Hdrlen);
+extern void HW_SCE_AesCcmEncryptPlaintextInputInit();
+extern void HW_SCE_AesCcmEncryptGenerateTag(uint32_t * OutData_MAC);
+
+/***********************************************************************************************************************
+ * Private variables and functions
+ ***********************************************************************************************************************/
+
+/* Session whose key is currently loaded in the AESKEYn registers */
+static hw_sce_aes_session_t * gp_aes_session_resident = NULL;
+
+/* Session whose message is in progress. The engine keeps the GHASH/CBC-MAC state of that message internally, so no
+ * other session can use the engine until the message is finished. */
+static hw_sce_aes_session_t * gp_aes_session_active = NULL;
+
+static void      hw_aes_session_gcm_start(hw_sce_aes_session_t * p_session,
+                                          const uint8_t        * InData_IV,
+                                          const uint8_t        * InData_DataA);
+static fsp_err_t hw_aes_session_blocks(hw_sce_aes_session_t * p_session, uint8_t * InOut_Text, uint32_t block);
+static fsp_err_t hw_aes_session_last_block(hw_sce_aes_session_t * p_session, uint8_t * InOut_Text, uint32_t len);
+static fsp_err_t hw_aes_session_gcm_tag(hw_sce_aes_session_t * p_session, uint8_t * OutData_DataT);
+static void      hw_aes_session_release(hw_sce_aes_session_t * p_session);
+
+/***********************************************************************************************************************
+ * Global variables and functions
+ ***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * @brief Open an AES-GCM/CCM session and keep a copy of its key
+ *
+ * @param[in,out] p_session     session to open
+ * @param[in]     mode          GCM or CCM
+ * @param[in]     InData_Key    plain key
+ * @param[in]     key_len       key length in byte (16, 24 or 32)
+ *
+ * @retval FSP_SUCCESS                  Session opened
+ * @retval FSP_ERR_INVALID_ARGUMENT     Invalid mode or key length
+ ***********************************************************************************************************************/
+fsp_err_t HW_SCE_AesSessionOpen (hw_sce_aes_session_t    * p_session,
+                                 hw_sce_aes_session_mode_t mode,
+                                 const uint32_t          * InData_Key,
+                                 uint32_t                  key_len)
+{
+    FSP_ERROR_RETURN((NULL != p_session) && (NULL != InData_Key), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((SIZE_AES_128BIT_KEYLEN_BYTES == key_len) || (SIZE_AES_192BIT_KEYLEN_BYTES == key_len) ||
+                     (SIZE_AES_256BIT_KEYLEN_BYTES == key_len),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((HW_SCE_AES_SESSION_MODE_GCM == mode) || (HW_SCE_AES_SESSION_MODE_CCM == mode),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    memset(p_session, 0, sizeof(hw_sce_aes_session_t));
+    memcpy(p_session->key, InData_Key, key_len);
+    p_session->key_len = key_len;
+    p_session->mode    = mode;
+    p_session->state   = HW_SCE_AES_SESSION_STATE_IDLE;
+
+    return FSP_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * @brief Start a message on a session: input the IV/nonce and the whole associated data
+ *
+ * The key is only written to the engine when another session or a one-shot operation used the engine since this
+ * session last ran. The engine is owned by the session until HW_SCE_AesSessionFinish.
+ *
+ * CCM sessions only encrypt. Decrypting CCM in chunks would need the engine to switch between the CTR and payload
+ * formatting phases for every chunk, which the one-shot path never does, so use the one-shot CCM decryption instead.
+ *
+ * @param[in,out] p_session     opened session
+ * @param[in]     encrypt       true to encrypt, false to decrypt (GCM only)
+ * @param[in]     InData_IV     IV (GCM) or nonce (CCM)
+ * @param[in]     iv_len        IV length in byte; CCM nonce must be 7 to 13 bytes
+ * @param[in]     InData_DataA  associated data, may be NULL when aad_len is 0
+ * @param[in]     aad_len       associated data length in byte
+ * @param[in]     text_len      length in byte of the payload that will be passed to HW_SCE_AesSessionUpdate
+ * @param[in]     tag_len       tag length in byte; CCM tag must be an even length from 4 to 16 bytes
+ *
+ * @retval FSP_SUCCESS                  Message started
+ * @retval FSP_ERR_NOT_OPEN             Session is not opened
+ * @retval FSP_ERR_IN_USE               Another session has a message in progress
+ * @retval FSP_ERR_INVALID_ARGUMENT     Invalid IV or tag length
+ * @retval FSP_ERR_UNSUPPORTED          CCM decryption requested
+ ***********************************************************************************************************************/
+fsp_err_t HW_SCE_AesSessionStart (hw_sce_aes_session_t * p_session,
+                                  bool                   encrypt,
+                                  const uint8_t        * InData_IV,
+                                  uint32_t               iv_len,
+                                  const uint8_t        * InData_DataA,
+                                  uint32_t               aad_len,
+                                  uint32_t               text_len,
+                                  uint32_t               tag_len)
+{
+    FSP_ERROR_RETURN(NULL != p_session, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(HW_SCE_AES_SESSION_STATE_CLOSED != p_session->state, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((NULL != InData_IV) && (0U != iv_len), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((NULL != InData_DataA) || (0U == aad_len), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U != tag_len) && (SIZE_AES_BLOCK_BYTES >= tag_len), FSP_ERR_INVALID_ARGUMENT);
+    if (HW_SCE_AES_SESSION_MODE_CCM == p_session->mode)
+    {
+        FSP_ERROR_RETURN(encrypt, FSP_ERR_UNSUPPORTED);
+        FSP_ERROR_RETURN((HW_SCE_AES_SESSION_CCM_NONCE_MIN_LEN <= iv_len) &&
+                         (HW_SCE_AES_SESSION_CCM_NONCE_MAX_LEN >= iv_len),
+                         FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN((HW_SCE_AES_SESSION_CCM_TAG_MIN_LEN <= tag_len) && (0U == (tag_len & 1U)),
+                         FSP_ERR_INVALID_ARGUMENT);
+    }
+
+    /* Claim the engine */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    bool in_use = (NULL != gp_aes_session_active) && (p_session != gp_aes_session_active);
+    if (!in_use)
+    {
+        gp_aes_session_active = p_session;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+    FSP_ERROR_RETURN(!in_use, FSP_ERR_IN_USE);
+
+    p_session->encrypt       = encrypt;
+    p_session->iv_len        = iv_len;
+    p_session->aad_len       = aad_len;
+    p_session->text_len      = text_len;
+    p_session->tag_len       = tag_len;
+    p_session->processed_len = 0U;
+    p_session->state         = HW_SCE_AES_SESSION_STATE_ACTIVE;
+
+    if (HW_SCE_AES_SESSION_MODE_GCM == p_session->mode)
+    {
+        hw_aes_session_gcm_start(p_session, InData_IV, InData_DataA);
+    }
+    else
+    {
+        /* The CCM common initialization resets the AES circuit, so the key is written for every message */
+        HW_SCE_AesCcmEncryptKeyOperation(p_session->key, p_session->key_len, (uint32_t *) InData_IV, iv_len);
+        HW_SCE_AesCcmEncryptCounterGenerate(text_len, aad_len, tag_len, iv_len);
+        HW_SCE_AesCcmEncryptInputAssociatedData((uint32_t *) InData_DataA, aad_len);
+        HW_SCE_AesCcmEncryptPlaintextInputInit();
+        gp_aes_session_resident = p_session;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * @brief Encrypt or decrypt a scatter-gather list of payload in place
+ *
+ * Segments may have any length and alignment. Word aligned runs of whole blocks are processed directly in the
+ * segment; blocks that straddle segments or are not word aligned are gathered into a local block and scattered back.
+ * Every call except the one that completes the payload must pass a multiple of 16 bytes in total.
+ *
+ * @param[in,out] p_session     session with a message in progress
+ * @param[in,out] p_sg          segments to process in place
+ * @param[in]     sg_count      number of segments
+ *
+ * @retval FSP_SUCCESS                  Segments processed
+ * @retval FSP_ERR_INVALID_STATE        No message in progress on the session
+ * @retval FSP_ERR_INVALID_SIZE         Payload exceeds text_len or a partial block is passed before the last call
+ * @retval FSP_ERR_TIMEOUT              AES engine did not complete
+ ***********************************************************************************************************************/
+fsp_err_t HW_SCE_AesSessionUpdate (hw_sce_aes_session_t * p_session, hw_sce_aes_sg_t const * p_sg, uint32_t sg_count)
+{
+    fsp_err_t err       = FSP_SUCCESS;
+    uint32_t  total_len = 0U;
+
+    FSP_ERROR_RETURN((NULL != p_session) && ((NULL != p_sg) || (0U == sg_count)), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(HW_SCE_AES_SESSION_STATE_ACTIVE == p_session->state, FSP_ERR_INVALID_STATE);
+
+    for (uint32_t i = 0U; i < sg_count; i++)
+    {
+        total_len += p_sg[i].length;
+    }
+
+    uint32_t remaining_len = p_session->text_len - p_session->processed_len;
+    FSP_ERROR_RETURN(total_len <= remaining_len, FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN((total_len == remaining_len) || (0U == HW_AES_DATA_GET_LAST_REMAINS(total_len)),
+                     FSP_ERR_INVALID_SIZE);
+
+    uint32_t  block[SIZE_AES_BLOCK_BYTES / sizeof(uint32_t)];
+    uint8_t * p_block = (uint8_t *) block;
+    uint8_t * p_piece[SIZE_AES_BLOCK_BYTES];
+    uint8_t   piece_len[SIZE_AES_BLOCK_BYTES];
+    uint32_t  num_pieces = 0U;
+    uint32_t  fill       = 0U;
+
+    for (uint32_t i = 0U; (i < sg_count) && (FSP_SUCCESS == err); i++)
+    {
+        uint8_t * p_data = p_sg[i].p_data;
+        uint32_t  len    = p_sg[i].length;
+
+        while ((len > 0U) && (FSP_SUCCESS == err))
+        {
+            if ((0U == fill) && (SIZE_AES_BLOCK_BYTES <= len) && HW_32BIT_ALIGNED((uint32_t) p_data))
+            {
+                /* Whole blocks in place */
+                uint32_t run_len = HW_AES_DATA_FIT_TO_BLOCK_SIZE(len);
+                err     = hw_aes_session_blocks(p_session, p_data, run_len / SIZE_AES_BLOCK_BYTES);
+                p_data += run_len;
+                len    -= run_len;
+                continue;
+            }
+
+            /* Gather into the local block, remembering where each piece came from */
+            uint32_t copy_len = SIZE_AES_BLOCK_BYTES - fill;
+            copy_len = (copy_len < len) ? copy_len : len;
+            memcpy(&p_block[fill], p_data, copy_len);
+            p_piece[num_pieces]   = p_data;
+            piece_len[num_pieces] = (uint8_t) copy_len;
+            num_pieces++;
+            fill   += copy_len;
+            p_data += copy_len;
+            len    -= copy_len;
+
+            if (SIZE_AES_BLOCK_BYTES == fill)
+            {
+                err = hw_aes_session_blocks(p_session, p_block, 1U);
+                for (uint32_t j = 0U, offset = 0U; j < num_pieces; offset += piece_len[j], j++)
+                {
+                    memcpy(p_piece[j], &p_block[offset], piece_len[j]);
+                }
+
+                num_pieces = 0U;
+                fill       = 0U;
+            }
+        }
+    }
+
+    if ((FSP_SUCCESS == err) && (0U < fill))
+    {
+        /* Partial last block of the payload */
+        memset(&p_block[fill], 0, SIZE_AES_BLOCK_BYTES - fill);
+        err = hw_aes_session_last_block(p_session, p_block, fill);
+        for (uint32_t j = 0U, offset = 0U; j < num_pieces; offset += piece_len[j], j++)
+        {
+            memcpy(p_piece[j], &p_block[offset], piece_len[j]);
+        }
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        hw_aes_session_release(p_session);
+
+        return err;
+    }
+
+    p_session->processed_len += total_len;
+
+    return FSP_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * @brief Finish the message in progress and release the engine
+ *
+ * On encryption the tag is written to InOut_DataT. On GCM decryption the tag in InOut_DataT is verified; when the
+ * verification fails the payload already written in place must be discarded by the caller.
+ *
+ * @param[in,out] p_session     session with a message in progress
+ * @param[in,out] InOut_DataT   tag of tag_len bytes
+ *
+ * @retval FSP_SUCCESS                      Message finished
+ * @retval FSP_ERR_INVALID_STATE            No message in progress or the payload is incomplete
+ * @retval FSP_ERR_CRYPTO_SCE_VERIFY_FAIL   Tag verification failed
+ * @retval FSP_ERR_TIMEOUT                  AES engine did not complete
+ ***********************************************************************************************************************/
+fsp_err_t HW_SCE_AesSessionFinish (hw_sce_aes_session_t * p_session, uint8_t * InOut_DataT)
+{
+    fsp_err_t err = FSP_SUCCESS;
+    uint32_t  tag[SIZE_AES_BLOCK_BYTES / sizeof(uint32_t)] = {0};
+
+    FSP_ERROR_RETURN((NULL != p_session) && (NULL != InOut_DataT), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(HW_SCE_AES_SESSION_STATE_ACTIVE == p_session->state, FSP_ERR_INVALID_STATE);
+    FSP_ERROR_RETURN(p_session->processed_len == p_session->text_len, FSP_ERR_INVALID_STATE);
+
+    if (HW_SCE_AES_SESSION_MODE_GCM == p_session->mode)
+    {
+        err = hw_aes_session_gcm_tag(p_session, (uint8_t *) tag);
+    }
+    else
+    {
+        HW_SCE_AesCcmEncryptGenerateTag(tag);
+    }
+
+    if ((FSP_SUCCESS == err) && p_session->encrypt)
+    {
+        memcpy(InOut_DataT, tag, p_session->tag_len);
+    }
+    else if (FSP_SUCCESS == err)
+    {
+        uint8_t   diff       = 0U;
+        uint8_t * p_computed = (uint8_t *) tag;
+
+        for (uint32_t i = 0U; i < p_session->tag_len; i++)
+        {
+            diff |= (uint8_t) (p_computed[i] ^ InOut_DataT[i]);
+        }
+
+        err = (0U == diff) ? FSP_SUCCESS : FSP_ERR_CRYPTO_SCE_VERIFY_FAIL;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    hw_aes_session_release(p_session);
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief Close a session and clear its key
+ *
+ * @param[in,out] p_session     session to close
+ *
+ * @retval FSP_SUCCESS                  Session closed
+ * @retval FSP_ERR_NOT_OPEN             Session is not opened
+ ***********************************************************************************************************************/
+fsp_err_t HW_SCE_AesSessionClose (hw_sce_aes_session_t * p_session)
+{
+    FSP_ERROR_RETURN(NULL != p_session, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(HW_SCE_AES_SESSION_STATE_CLOSED != p_session->state, FSP_ERR_NOT_OPEN);
+
+    hw_aes_session_release(p_session);
+
+    if (gp_aes_session_resident == p_session)
+    {
+        gp_aes_session_resident = NULL;
+    }
+
+    memset(p_session, 0, sizeof(hw_sce_aes_session_t));
+
+    return FSP_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * @brief Forget which session key is loaded in the engine. Called whenever the AESKEYn registers are written.
+ ***********************************************************************************************************************/
+void hw_aes_session_key_invalidate (void)
+{
+    gp_aes_session_resident = NULL;
+}
+
+/***********************************************************************************************************************
+ * @brief Check if a session message owns the engine. One-shot operations must not start while it does.
+ *
+ * @retval true                         A session message is in progress
+ * @retval false                        The engine is free for one-shot operations
+ ***********************************************************************************************************************/
+bool hw_aes_session_in_progress (void)
+{
+    return NULL != gp_aes_session_active;
+}
+
+/***********************************************************************************************************************
+ * @brief Select GCM, restore the session key if needed, compute J0 and input the associated data
+ *
+ * @param[in,out] p_session     session starting a message
+ * @param[in]     InData_IV     IV
+ * @param[in]     InData_DataA  associated data
+ ***********************************************************************************************************************/
+static void hw_aes_session_gcm_start (hw_sce_aes_session_t * p_session,
+                                      const uint8_t        * InData_IV,
+                                      const uint8_t        * InData_DataA)
+{
+    uint32_t temp_block[SIZE_AES_BLOCK_BYTES / sizeof(uint32_t)];
+    uint32_t remaining_len;
+    uint32_t block_len;
+    uint16_t cntl;
+
+    if (SIZE_AES_128BIT_KEYLEN_BYTES == p_session->key_len)
+    {
+        cntl = p_session->encrypt ? R_AES_AESCNTL_GCM_128_ENC : R_AES_AESCNTL_GCM_128_DEC;
+    }
+    else if (SIZE_AES_192BIT_KEYLEN_BYTES == p_session->key_len)
+    {
+        cntl = p_session->encrypt ? R_AES_AESCNTL_GCM_192_ENC : R_AES_AESCNTL_GCM_192_DEC;
+    }
+    else
+    {
+        cntl = p_session->encrypt ? R_AES_AESCNTL_GCM_256_ENC : R_AES_AESCNTL_GCM_256_DEC;
+    }
+
+    R_AES_B->AESCNTL = cntl;
+
+    /* Restore the key only when the engine holds another one */
+    if (gp_aes_session_resident != p_session)
+    {
+        hw_aes_set_key((uint8_t *) p_session->key, p_session->key_len);
+        gp_aes_session_resident = p_session;
+    }
+
+    /* J0 Calculation from IV */
+    memset(p_session->j0, 0, sizeof(p_session->j0));
+    if (HW_SCE_AES_SESSION_GCM_IV_96BITS_LEN == p_session->iv_len)
+    {
+        memcpy(p_session->j0, InData_IV, HW_SCE_AES_SESSION_GCM_IV_96BITS_LEN);
+        ((uint8_t *) p_session->j0)[SIZE_AES_BLOCK_BYTES - 1U] = 1U;
+    }
+    else
+    {
+        const uint8_t * p_iv = InData_IV;
+        remaining_len = p_session->iv_len;
+
+        R_AES_B->AESDCNTL |= R_AES_AESDCNTL_BIT_2 | R_AES_AESDCNTL_BIT_3;
+
+        while (remaining_len > 0U)
+        {
+            block_len = (remaining_len < SIZE_AES_BLOCK_BYTES) ? remaining_len : SIZE_AES_BLOCK_BYTES;
+            memset(temp_block, 0, sizeof(temp_block));
+            memcpy(temp_block, p_iv, block_len);
+            hw_aes_start((uint8_t *) temp_block, (uint8_t *) p_session->j0, 1U);
+
+            p_iv          += block_len;
+            remaining_len -= block_len;
+        }
+
+        temp_block[0] = 0U;
+        temp_block[1] = 0U;
+        temp_block[2] = __REV(p_session->iv_len >> 29);
+        temp_block[3] = __REV(p_session->iv_len << 3);
+        hw_aes_start((uint8_t *) temp_block, (uint8_t *) p_session->j0, 1U);
+    }
+
+    /* J1 = inc32(J0) */
+    memcpy(temp_block, p_session->j0, sizeof(temp_block));
+    temp_block[3] = __REV(__REV(temp_block[3]) + 1U);
+    hw_aes_set_iv((uint8_t *) temp_block);
+
+    /* Acquire hash value of AAD */
+    p_session->first_block = (0U == p_session->aad_len);
+    if (0U < p_session->aad_len)
+    {
+        const uint8_t * p_aad = InData_DataA;
+        remaining_len = p_session->aad_len;
+
+        R_AES_B->AESDCNTL = R_AES_AESDCNTL_BIT_3 | R_AES_AESDCNTL_BIT_2;
+
+        while (remaining_len > 0U)
+        {
+            block_len = (remaining_len < SIZE_AES_BLOCK_BYTES) ? remaining_len : SIZE_AES_BLOCK_BYTES;
+            memset(temp_block, 0, sizeof(temp_block));
+            memcpy(temp_block, p_aad, block_len);
+            hw_aes_start((uint8_t *) temp_block, (uint8_t *) temp_block, 1U);
+
+            p_aad         += block_len;
+            remaining_len -= block_len;
+        }
+    }
+}
+
+/***********************************************************************************************************************
+ * @brief Process whole payload blocks in place
+ *
+ * @param[in,out] p_session     session with a message in progress
+ * @param[in,out] InOut_Text    word aligned payload
+ * @param[in]     block         number of blocks
+ *
+ * @retval FSP_SUCCESS                  Blocks processed
+ * @retval FSP_ERR_TIMEOUT              AES engine did not complete
+ ***********************************************************************************************************************/
+static fsp_err_t hw_aes_session_blocks (hw_sce_aes_session_t * p_session, uint8_t * InOut_Text, uint32_t block)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (HW_SCE_AES_SESSION_MODE_GCM == p_session->mode)
+    {
+        for (uint32_t i = 0U; (i < block) && (FSP_SUCCESS == err); i++)
+        {
+            R_AES_B->AESDCNTL = R_AES_AESDCNTL_BIT_5;
+            if (p_session->first_block)
+            {
+                p_session->first_block = false;
+                R_AES_B->AESDCNTL     |= R_AES_AESDCNTL_BIT_3 | R_AES_AESDCNTL_BIT_2;
+            }
+
+            err         = hw_aes_start(InOut_Text, InOut_Text, 1U);
+            InOut_Text += SIZE_AES_BLOCK_BYTES;
+        }
+    }
+    else
+    {
+        /* Engine is left in plaintext input mode by the start of the message */
+        hw_aes_ccm_mode_start(InOut_Text, InOut_Text, block);
+    }
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief Process the partial last block of the payload
+ *
+ * @param[in,out] p_session     session with a message in progress
+ * @param[in,out] InOut_Text    word aligned block, zero padded after len bytes
+ * @param[in]     len           number of payload bytes in the block
+ *
+ * @retval FSP_SUCCESS                  Block processed
+ * @retval FSP_ERR_TIMEOUT              AES engine did not complete
+ ***********************************************************************************************************************/
+static fsp_err_t hw_aes_session_last_block (hw_sce_aes_session_t * p_session, uint8_t * InOut_Text, uint32_t len)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (HW_SCE_AES_SESSION_MODE_GCM == p_session->mode)
+    {
+        R_AES_B->AESDCNTL = R_AES_AESDCNTL_BIT_5;
+        if (p_session->first_block)
+        {
+            p_session->first_block = false;
+            R_AES_B->AESDCNTL     |= R_AES_AESDCNTL_BIT_3 | R_AES_AESDCNTL_BIT_2;
+        }
+
+        R_AES_B->AESDCNTL |= (uint16_t) (((len * 8U) << 8) | R_AES_AESDCNTL_BIT_4);
+        err                = hw_aes_start(InOut_Text, InOut_Text, 1U);
+    }
+    else
+    {
+        hw_aes_ccm_mode_start(InOut_Text, InOut_Text, 1U);
+    }
+
+    return err;
+}
+
+/***********************************************************************************************************************
+ * @brief Compute the GCM tag of the message in progress
+ *
+ * @param[in]  p_session        session with a message in progress
+ * @param[out] OutData_DataT    16 byte word aligned tag
+ *
+ * @retval FSP_SUCCESS                  Tag computed
+ * @retval FSP_ERR_TIMEOUT              AES engine did not complete
+ ***********************************************************************************************************************/
+static fsp_err_t hw_aes_session_gcm_tag (hw_sce_aes_session_t * p_session, uint8_t * OutData_DataT)
+{
+    uint32_t len_block[SIZE_AES_BLOCK_BYTES / sizeof(uint32_t)];
+
+    hw_aes_set_iv((uint8_t *) p_session->j0);
+
+    /* len(A) || len(C) in bits, big endian */
+    len_block[0] = __REV(p_session->aad_len >> 29);
+    len_block[1] = __REV(p_session->aad_len << 3);
+    len_block[2] = __REV(p_session->text_len >> 29);
+    len_block[3] = __REV(p_session->text_len << 3);
+
+    if ((0U == p_session->aad_len) && (0U == p_session->text_len))
+    {
+        R_AES_B->AESDCNTL = (HW_SCE_AES_SESSION_GCM_IV_96BITS_LEN == p_session->iv_len) ?
+                            (R_AES_AESDCNTL_BIT_2 | R_AES_AESDCNTL_BIT_3 | R_AES_AESDCNTL_BIT_6) :
+                            (R_AES_AESDCNTL_BIT_2 | R_AES_AESDCNTL_BIT_6);
+    }
+    else
+    {
+        R_AES_B->AESDCNTL = R_AES_AESDCNTL_BIT_6;
+    }
+
+    return hw_aes_start((uint8_t *) len_block, OutData_DataT, 1U);
+}
+
+/***********************************************************************************************************************
+ * @brief End the message in progress on a session and release the engine
+ *
+ * @param[in,out] p_session     session
+ ***********************************************************************************************************************/
+static void hw_aes_session_release (hw_sce_aes_session_t * p_session)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (gp_aes_session_active == p_session)
+    {
+        gp_aes_session_active = NULL;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (HW_SCE_AES_SESSION_STATE_ACTIVE == p_session->state)
+    {
+        p_session->state = HW_SCE_AES_SESSION_STATE_IDLE;
+    }
+}
@@ -0,0 +1,643 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "bsp_api.h"
+#include "hw_sce_benchmark.h"
+
+#if BSP_FEATURE_RSIP_SCE9_SUPPORTED || BSP_FEATURE_RSIP_SCE7_SUPPORTED || BSP_FEATURE_RSIP_SCE5_SUPPORTED ||           \
+    BSP_FEATURE_RSIP_SCE5B_SUPPORTED || BSP_FEATURE_RSIP_RSIP_E11A_SUPPORTED ||                                         \
+    BSP_FEATURE_RSIP_RSIP_E31A_SUPPORTED || BSP_FEATURE_RSIP_RSIP_E50D_SUPPORTED ||                                     \
+    BSP_FEATURE_RSIP_RSIP_E51A_SUPPORTED
+ #define HW_SCE_BENCH_ADAPTOR    (1)
+ #include "hw_sce_private.h"
+ #include "hw_sce_aes_private.h"
+ #include "hw_sce_hash_private.h"
+#else
+ #define HW_SCE_BENCH_ADAPTOR    (0)
+#endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Message size of the public-key algorithms, which do not scale with the configured sizes. */
+#define HW_SCE_BENCH_ECDSA_DIGEST_SIZE    (32U)
+#define HW_SCE_BENCH_RSA2048_SIZE         (256U)
+
+#define HW_SCE_BENCH_AES_BLOCK_SIZE       (16U)
+#define HW_SCE_BENCH_CCM_NONCE_SIZE       (12U)
+
+/* Algorithms that process the configured message sizes. The others run once per call at their fixed size. */
+#define HW_SCE_BENCH_SIZED_ALGS           ((1U << HW_SCE_BENCH_ALG_AES128_ECB) |  \
+                                           (1U << HW_SCE_BENCH_ALG_AES128_CBC) |  \
+                                           (1U << HW_SCE_BENCH_ALG_AES128_CTR) |  \
+                                           (1U << HW_SCE_BENCH_ALG_AES128_GCM) |  \
+                                           (1U << HW_SCE_BENCH_ALG_AES128_CCM) |  \
+                                           (1U << HW_SCE_BENCH_ALG_SHA256))
+
+#if HW_SCE_BENCH_ADAPTOR
+ #if BSP_FEATURE_RSIP_SCE9_SUPPORTED || BSP_FEATURE_RSIP_SCE7_SUPPORTED || BSP_FEATURE_RSIP_RSIP_E31A_SUPPORTED || \
+    BSP_FEATURE_RSIP_RSIP_E50D_SUPPORTED || BSP_FEATURE_RSIP_RSIP_E51A_SUPPORTED
+  #define HW_SCE_BENCH_HAS_SHA             (1)
+ #else
+  #define HW_SCE_BENCH_HAS_SHA             (0)
+ #endif
+ #if BSP_FEATURE_RSIP_SCE5_SUPPORTED
+  #define HW_SCE_BENCH_HAS_GCM_TRANSITION    (0)
+  #define HW_SCE_BENCH_HAS_ECDSA_SIGN        (0)
+ #else
+  #define HW_SCE_BENCH_HAS_GCM_TRANSITION    (1)
+  #define HW_SCE_BENCH_HAS_ECDSA_SIGN        (1)
+ #endif
+ #if BSP_FEATURE_RSIP_SCE5_SUPPORTED || BSP_FEATURE_RSIP_SCE5B_SUPPORTED
+  #define HW_SCE_BENCH_HAS_ECDSA_VERIFY      (0)
+ #else
+  #define HW_SCE_BENCH_HAS_ECDSA_VERIFY      (1)
+ #endif
+ #if BSP_FEATURE_RSIP_SCE9_SUPPORTED || BSP_FEATURE_RSIP_SCE7_SUPPORTED || BSP_FEATURE_RSIP_RSIP_E50D_SUPPORTED || \
+    BSP_FEATURE_RSIP_RSIP_E51A_SUPPORTED
+  #define HW_SCE_BENCH_HAS_RSA2048           (1)
+ #else
+  #define HW_SCE_BENCH_HAS_RSA2048           (0)
+ #endif
+#endif
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t hw_sce_bench_size_get(hw_sce_bench_alg_t alg, uint32_t size);
+static void     hw_sce_bench_measure(hw_sce_bench_cfg_t const * p_cfg, hw_sce_bench_result_t * p_result);
+static uint32_t hw_sce_bench_append_str(char * p_buf, uint32_t size, uint32_t pos, char const * p_str);
+static uint32_t hw_sce_bench_append_u64(char * p_buf, uint32_t size, uint32_t pos, uint64_t value);
+
+#if HW_SCE_BENCH_ADAPTOR
+static void      hw_sce_bench_adaptor_open(void);
+static fsp_err_t hw_sce_bench_adaptor_setup(hw_sce_bench_alg_t alg, hw_sce_bench_keys_t const * p_keys, uint32_t size);
+static fsp_err_t hw_sce_bench_adaptor_process(hw_sce_bench_alg_t          alg,
+                                              hw_sce_bench_keys_t const * p_keys,
+                                              uint8_t const             * p_in,
+                                              uint8_t                   * p_out,
+                                              uint32_t                    size);
+static uint32_t hw_sce_bench_adaptor_cycles(void);
+
+#endif
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+static char const * const g_hw_sce_bench_alg_names[HW_SCE_BENCH_ALG_NUM] =
+{
+    [HW_SCE_BENCH_ALG_AES128_ECB]        = "aes128_ecb",
+    [HW_SCE_BENCH_ALG_AES128_CBC]        = "aes128_cbc",
+    [HW_SCE_BENCH_ALG_AES128_CTR]        = "aes128_ctr",
+    [HW_SCE_BENCH_ALG_AES128_GCM]        = "aes128_gcm",
+    [HW_SCE_BENCH_ALG_AES128_CCM]        = "aes128_ccm",
+    [HW_SCE_BENCH_ALG_SHA256]            = "sha256",
+    [HW_SCE_BENCH_ALG_ECDSA_P256_SIGN]   = "ecdsa_p256_sign",
+    [HW_SCE_BENCH_ALG_ECDSA_P256_VERIFY] = "ecdsa_p256_verify",
+    [HW_SCE_BENCH_ALG_RSA2048_PUBLIC]    = "rsa2048_public",
+    [HW_SCE_BENCH_ALG_RSA2048_PRIVATE]   = "rsa2048_private",
+};
+
+#if HW_SCE_BENCH_ADAPTOR
+
+/* CCM counter block and B0 block of the operation set up last. */
+static uint32_t g_hw_sce_bench_ccm_ctr[4];
+static uint32_t g_hw_sce_bench_ccm_b0[4];
+
+/* GCM and CCM tag of the last operation. */
+static uint32_t g_hw_sce_bench_tag[4];
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+const hw_sce_bench_backend_t g_hw_sce_bench_adaptor =
+{
+    .p_open    = hw_sce_bench_adaptor_open,
+    .p_setup   = hw_sce_bench_adaptor_setup,
+    .p_process = hw_sce_bench_adaptor_process,
+    .p_cycles  = hw_sce_bench_adaptor_cycles,
+};
+#endif
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Times each selected algorithm over the message sizes min_size, 2 * min_size, ... up to max_size. Setup (key and IV
+ * loading) and processing are timed separately so that the fixed cost of an operation can be told apart from its
+ * per-byte cost. The public-key algorithms run once at their own size. Results of an algorithm the backend does not
+ * support have err set to FSP_ERR_UNSUPPORTED.
+ *
+ * The SCE must be initialized and no other SCE procedure may run while this function runs.
+ *
+ * @param[in]  p_cfg        Configuration
+ * @param[out] p_results    Results, in algorithm order then size order
+ * @param[in]  max_results  Number of entries in p_results
+ * @param[out] p_count      Number of results written
+ *
+ * @retval FSP_SUCCESS             The selected algorithms were measured. Check err in each result.
+ * @retval FSP_ERR_ASSERTION       A pointer is NULL or a buffer is not word aligned.
+ * @retval FSP_ERR_INVALID_ARGUMENT  A size is out of range or not a multiple of 16, or iterations is 0.
+ * @retval FSP_ERR_INVALID_SIZE    p_results is too small. p_count is set to the number of entries needed.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_BenchRun (hw_sce_bench_cfg_t const * p_cfg,
+                           hw_sce_bench_result_t    * p_results,
+                           uint32_t                   max_results,
+                           uint32_t                 * p_count)
+{
+    FSP_ERROR_RETURN(NULL != p_cfg, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_count, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN((NULL != p_results) || (0U == max_results), FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_backend, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_backend->p_setup, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_backend->p_process, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_backend->p_cycles, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_keys, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN((NULL != p_cfg->p_in) && (0U == ((uintptr_t) p_cfg->p_in & 3U)), FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN((NULL != p_cfg->p_out) && (0U == ((uintptr_t) p_cfg->p_out & 3U)), FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(0U != p_cfg->iterations, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((p_cfg->min_size >= HW_SCE_BENCH_MIN_SIZE) && (p_cfg->max_size <= HW_SCE_BENCH_MAX_SIZE) &&
+                     (p_cfg->min_size <= p_cfg->max_size),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U == (p_cfg->min_size % HW_SCE_BENCH_AES_BLOCK_SIZE)) &&
+                     (0U == (p_cfg->max_size % HW_SCE_BENCH_AES_BLOCK_SIZE)),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    /* Count the results first so that a short p_results is reported before anything runs. */
+    uint32_t count = 0U;
+    for (uint32_t alg = 0U; alg < (uint32_t) HW_SCE_BENCH_ALG_NUM; alg++)
+    {
+        if (0U != (p_cfg->alg_mask & (1U << alg)))
+        {
+            for (uint32_t size = p_cfg->min_size; size <= p_cfg->max_size; size *= 2U)
+            {
+                count++;
+                if (0U == (HW_SCE_BENCH_SIZED_ALGS & (1U << alg)))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    *p_count = count;
+    FSP_ERROR_RETURN(count <= max_results, FSP_ERR_INVALID_SIZE);
+
+    if (NULL != p_cfg->p_backend->p_open)
+    {
+        p_cfg->p_backend->p_open();
+    }
+
+    count = 0U;
+    for (uint32_t alg = 0U; alg < (uint32_t) HW_SCE_BENCH_ALG_NUM; alg++)
+    {
+        if (0U != (p_cfg->alg_mask & (1U << alg)))
+        {
+            for (uint32_t size = p_cfg->min_size; size <= p_cfg->max_size; size *= 2U)
+            {
+                hw_sce_bench_result_t * p_result = &p_results[count++];
+
+                p_result->alg  = (hw_sce_bench_alg_t) alg;
+                p_result->size = hw_sce_bench_size_get((hw_sce_bench_alg_t) alg, size);
+                hw_sce_bench_measure(p_cfg, p_result);
+
+                if (0U == (HW_SCE_BENCH_SIZED_ALGS & (1U << alg)))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Formats a result as one line of comma-separated values in the HW_SCE_BENCH_CSV_HEADER column order, without a line
+ * ending. cycles_per_byte_x100 is the total cycles per processed byte times 100. ops_per_sec is derived from the total
+ * cycles and core_hz, and is 0 if either is 0. Only decimal integers are written, so the line does not depend on
+ * printf support in the C library.
+ *
+ * @param[in]  p_result  Result
+ * @param[in]  core_hz   CPU clock the cycles were counted at, normally SystemCoreClock
+ * @param[out] p_buf     Destination, NUL terminated
+ * @param[in]  size      Size of p_buf in bytes
+ *
+ * @return Length of the line, or 0 if p_result or p_buf is NULL or the line does not fit.
+ **********************************************************************************************************************/
+uint32_t HW_SCE_BenchFormat (hw_sce_bench_result_t const * p_result, uint32_t core_hz, char * p_buf, uint32_t size)
+{
+    if ((NULL == p_result) || (NULL == p_buf) || (0U == size))
+    {
+        return 0U;
+    }
+
+    uint64_t total   = p_result->setup_cycles + p_result->process_cycles;
+    uint64_t bytes   = (uint64_t) p_result->size * p_result->iterations;
+    uint64_t cpb_100 = (0U != bytes) ? ((total * 100U) / bytes) : 0U;
+    uint64_t ops     = (0U != total) ? (((uint64_t) p_result->iterations * core_hz) / total) : 0U;
+    uint32_t pos     = 0U;
+
+    pos = hw_sce_bench_append_str(p_buf, size, pos, HW_SCE_BenchAlgName(p_result->alg));
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, p_result->size);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, p_result->iterations);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, (uint32_t) p_result->err);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, p_result->setup_cycles);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, p_result->process_cycles);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, cpb_100);
+    pos = hw_sce_bench_append_str(p_buf, size, pos, ",");
+    pos = hw_sce_bench_append_u64(p_buf, size, pos, ops);
+
+    if (pos >= size)
+    {
+        p_buf[0] = '\0';
+
+        return 0U;
+    }
+
+    p_buf[pos] = '\0';
+
+    return pos;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the name used for an algorithm in the alg column.
+ *
+ * @param[in] alg  Algorithm
+ *
+ * @return Name, or "unknown" if alg is out of range.
+ **********************************************************************************************************************/
+char const * HW_SCE_BenchAlgName (hw_sce_bench_alg_t alg)
+{
+    if ((uint32_t) alg >= (uint32_t) HW_SCE_BENCH_ALG_NUM)
+    {
+        return "unknown";
+    }
+
+    return g_hw_sce_bench_alg_names[alg];
+}
+
+/*******************************************************************************************************************//**
+ * Gets the number of bytes one operation of an algorithm processes.
+ *
+ * @param[in] alg   Algorithm
+ * @param[in] size  Configured message size
+ *
+ * @return size for the symmetric algorithms and SHA-256, the digest or modulus size for the public-key algorithms.
+ **********************************************************************************************************************/
+static uint32_t hw_sce_bench_size_get (hw_sce_bench_alg_t alg, uint32_t size)
+{
+    if ((HW_SCE_BENCH_ALG_ECDSA_P256_SIGN == alg) || (HW_SCE_BENCH_ALG_ECDSA_P256_VERIFY == alg))
+    {
+        return HW_SCE_BENCH_ECDSA_DIGEST_SIZE;
+    }
+
+    if ((HW_SCE_BENCH_ALG_RSA2048_PUBLIC == alg) || (HW_SCE_BENCH_ALG_RSA2048_PRIVATE == alg))
+    {
+        return HW_SCE_BENCH_RSA2048_SIZE;
+    }
+
+    return size;
+}
+
+/*******************************************************************************************************************//**
+ * Runs the configured number of operations for one algorithm and size. The measurement stops at the first error.
+ * Each phase is timed with a 32-bit cycle difference, which is exact as long as one phase takes less than 2^32 cycles.
+ *
+ * @param[in]     p_cfg     Configuration
+ * @param[in,out] p_result  alg and size are read, the other fields are written
+ **********************************************************************************************************************/
+static void hw_sce_bench_measure (hw_sce_bench_cfg_t const * p_cfg, hw_sce_bench_result_t * p_result)
+{
+    hw_sce_bench_backend_t const * p_backend = p_cfg->p_backend;
+
+    p_result->iterations     = 0U;
+    p_result->err            = FSP_SUCCESS;
+    p_result->setup_cycles   = 0U;
+    p_result->process_cycles = 0U;
+
+    for (uint32_t i = 0U; i < p_cfg->iterations; i++)
+    {
+        uint32_t  start = p_backend->p_cycles();
+        fsp_err_t err   = p_backend->p_setup(p_result->alg, p_cfg->p_keys, p_result->size);
+        uint32_t  mid   = p_backend->p_cycles();
+
+        if (FSP_SUCCESS == err)
+        {
+            err = p_backend->p_process(p_result->alg, p_cfg->p_keys, p_cfg->p_in, p_cfg->p_out, p_result->size);
+        }
+
+        uint32_t end = p_backend->p_cycles();
+
+        if (FSP_SUCCESS != err)
+        {
+            p_result->err = err;
+            break;
+        }
+
+        p_result->setup_cycles   += mid - start;
+        p_result->process_cycles += end - mid;
+        p_result->iterations++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Appends a string. Characters that do not fit are dropped, but pos still advances so that the caller can detect
+ * the overflow.
+ *
+ * @return Position after the string.
+ **********************************************************************************************************************/
+static uint32_t hw_sce_bench_append_str (char * p_buf, uint32_t size, uint32_t pos, char const * p_str)
+{
+    while ('\0' != *p_str)
+    {
+        if (pos < size)
+        {
+            p_buf[pos] = *p_str;
+        }
+
+        pos++;
+        p_str++;
+    }
+
+    return pos;
+}
+
+/*******************************************************************************************************************//**
+ * Appends an unsigned decimal number.
+ *
+ * @return Position after the number.
+ **********************************************************************************************************************/
+static uint32_t hw_sce_bench_append_u64 (char * p_buf, uint32_t size, uint32_t pos, uint64_t value)
+{
+    char     digits[21];
+    uint32_t i = sizeof(digits) - 1U;
+
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = (char) ('0' + (value % 10U));
+        value      /= 10U;
+    } while (0U != value);
+
+    return hw_sce_bench_append_str(p_buf, size, pos, &digits[i]);
+}
+
+#if HW_SCE_BENCH_ADAPTOR
+
+/*******************************************************************************************************************//**
+ * Starts the DWT cycle counter if it is not running.
+ **********************************************************************************************************************/
+static void hw_sce_bench_adaptor_open (void)
+{
+ #if BSP_FEATURE_DWT_CYCCNT
+    if (0U == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+  #ifdef DCB
+        DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  #else
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  #endif
+        DWT->CYCCNT = 0U;
+        DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Read the CPU cycle counter.
+ **********************************************************************************************************************/
+static uint32_t hw_sce_bench_adaptor_cycles (void)
+{
+ #if BSP_FEATURE_DWT_CYCCNT
+
+    return DWT->CYCCNT;
+ #else
+
+    return 0U;
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Loads the key and IV of a symmetric operation. The public-key algorithms and SHA-256 are one-shot procedures with
+ * nothing to set up.
+ *
+ * CCM B0 and counter blocks are built here as in RFC 3610 with a 12-byte nonce, a 3-byte length field, a 16-byte tag
+ * and no associated data.
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_bench_adaptor_setup (hw_sce_bench_alg_t alg, hw_sce_bench_keys_t const * p_keys, uint32_t size)
+{
+    fsp_err_t err = FSP_SUCCESS;
+    uint32_t  cmd;
+
+    switch (alg)
+    {
+        case HW_SCE_BENCH_ALG_AES128_ECB:
+        case HW_SCE_BENCH_ALG_AES128_CBC:
+        case HW_SCE_BENCH_ALG_AES128_CTR:
+        {
+            if (HW_SCE_BENCH_ALG_AES128_ECB == alg)
+            {
+                cmd = change_endian_long(SCE_AES_IN_DATA_CMD_ECB_ENCRYPTION);
+            }
+            else if (HW_SCE_BENCH_ALG_AES128_CBC == alg)
+            {
+                cmd = change_endian_long(SCE_AES_IN_DATA_CMD_CBC_ENCRYPTION);
+            }
+            else
+            {
+                cmd = change_endian_long(SCE_AES_IN_DATA_CMD_CTR_ENCRYPTION_DECRYPTION);
+            }
+
+            err = HW_SCE_Aes128EncryptDecryptInitSubAdaptor(p_keys->p_aes_key_type, &cmd, p_keys->p_aes_key_index,
+                                                            NULL, p_keys->p_aes_iv);
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_AES128_GCM:
+        {
+            uint32_t data_type = 0U;
+            uint32_t seq_num   = 0U;
+
+            cmd = 0U;
+            err = HW_SCE_Aes128GcmEncryptInitSubGeneral(p_keys->p_aes_key_type, &data_type, &cmd,
+                                                        p_keys->p_aes_key_index, p_keys->p_aes_iv, &seq_num);
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_AES128_CCM:
+        {
+            uint8_t * p_b0      = (uint8_t *) g_hw_sce_bench_ccm_b0;
+            uint8_t * p_ctr     = (uint8_t *) g_hw_sce_bench_ccm_ctr;
+            uint32_t  data_type = 0U;
+            uint32_t  seq_num   = 0U;
+            uint32_t  text_len  = change_endian_long(size);
+
+            /* Flags: no AAD, M = 16 ((16 - 2) / 2 << 3), L = 3 (L - 1). */
+            p_b0[0] = (uint8_t) ((((16U - 2U) / 2U) << 3U) | (3U - 1U));
+            memcpy(&p_b0[1], p_keys->p_aes_iv, HW_SCE_BENCH_CCM_NONCE_SIZE);
+            p_b0[13] = (uint8_t) (size >> 16);
+            p_b0[14] = (uint8_t) (size >> 8);
+            p_b0[15] = (uint8_t) size;
+
+            p_ctr[0] = (uint8_t) (3U - 1U);
+            memcpy(&p_ctr[1], p_keys->p_aes_iv, HW_SCE_BENCH_CCM_NONCE_SIZE);
+            p_ctr[13] = 0U;
+            p_ctr[14] = 0U;
+            p_ctr[15] = 0U;
+
+            cmd = 0U;
+            err = HW_SCE_Aes128CcmEncryptInitSubGeneral(p_keys->p_aes_key_type, &data_type, &cmd, &text_len,
+                                                        p_keys->p_aes_key_index, g_hw_sce_bench_ccm_ctr,
+                                                        g_hw_sce_bench_ccm_b0, &seq_num, sizeof(g_hw_sce_bench_ccm_b0));
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Runs the timed part of an operation. Messages are whole AES blocks, so the symmetric algorithms pass everything
+ * through the update procedure and finish with an empty final block. Lengths are passed in the engine word order, as
+ * the adaptors expect.
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_bench_adaptor_process (hw_sce_bench_alg_t          alg,
+                                               hw_sce_bench_keys_t const * p_keys,
+                                               uint8_t const             * p_in,
+                                               uint8_t                   * p_out,
+                                               uint32_t                    size)
+{
+    fsp_err_t        err     = FSP_ERR_UNSUPPORTED;
+    uint32_t const * p_in32  = (uint32_t const *) p_in;
+    uint32_t       * p_out32 = (uint32_t *) p_out;
+    uint32_t         words   = size / sizeof(uint32_t);
+    uint32_t         last[4] = {0U};
+
+    FSP_PARAMETER_NOT_USED(p_keys);
+
+    switch (alg)
+    {
+        case HW_SCE_BENCH_ALG_AES128_ECB:
+        case HW_SCE_BENCH_ALG_AES128_CBC:
+        case HW_SCE_BENCH_ALG_AES128_CTR:
+        {
+            HW_SCE_Aes128EncryptDecryptUpdateSub(p_in32, p_out32, words);
+            err = HW_SCE_Aes128EncryptDecryptFinalSub();
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_AES128_GCM:
+        {
+            uint32_t text_len[2] =
+            {
+                change_endian_long(r_sce_byte_to_bit_convert_upper(size)),
+                change_endian_long(r_sce_byte_to_bit_convert_lower(size))
+            };
+            uint32_t aad_len[2] = {0U, 0U};
+
+ #if HW_SCE_BENCH_HAS_GCM_TRANSITION
+            HW_SCE_Aes128GcmEncryptUpdateTransitionSub();
+ #endif
+            HW_SCE_Aes128GcmEncryptUpdateSub(p_in32, p_out32, words);
+            err = HW_SCE_Aes128GcmEncryptFinalSub(last, text_len, aad_len, last, g_hw_sce_bench_tag);
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_AES128_CCM:
+        {
+            uint32_t text_len = change_endian_long(size);
+
+            HW_SCE_Aes128CcmEncryptUpdateSub(p_in32, p_out32, words);
+            err = HW_SCE_Aes128CcmEncryptFinalSubGeneral(last, &text_len, last, g_hw_sce_bench_tag);
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_SHA256:
+        {
+ #if HW_SCE_BENCH_HAS_SHA
+            uint32_t hash_type = change_endian_long(SCE_OEM_CMD_HASH_TYPE_SHA256);
+            uint32_t cmd       = change_endian_long(SCE_OEM_CMD_HASH_ONESHOT);
+            uint32_t msg_len[2] =
+            {
+                change_endian_long(r_sce_byte_to_bit_convert_upper(size)),
+                change_endian_long(r_sce_byte_to_bit_convert_lower(size))
+            };
+
+            err = HW_SCE_ShaGenerateMessageDigestSubGeneral(&hash_type, &cmd, p_in32, msg_len, NULL, p_out32, NULL,
+                                                            words, NULL);
+ #endif
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_ECDSA_P256_SIGN:
+        {
+ #if HW_SCE_BENCH_HAS_ECDSA_SIGN
+
+            /* The signature is left in p_out for the verify step. */
+            err = HW_SCE_EcdsaSignatureGenerateSubAdaptor(p_keys->p_ecc_curve_type, p_keys->p_ecc_cmd,
+                                                          p_keys->p_ecc_private_key_index, p_in32, NULL, p_out32);
+ #endif
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_ECDSA_P256_VERIFY:
+        {
+ #if HW_SCE_BENCH_HAS_ECDSA_VERIFY
+            err = HW_SCE_EcdsaSignatureVerificationSubAdaptor(p_keys->p_ecc_curve_type, p_keys->p_ecc_cmd,
+                                                              p_keys->p_ecc_public_key_index, NULL, p_in32, p_out32,
+                                                              NULL);
+ #endif
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_RSA2048_PUBLIC:
+        {
+ #if HW_SCE_BENCH_HAS_RSA2048
+            err = HW_SCE_Rsa2048ModularExponentEncryptSubAdaptor(p_keys->p_rsa_public_key_index, NULL, p_in32,
+                                                                 p_out32);
+ #endif
+            break;
+        }
+
+        case HW_SCE_BENCH_ALG_RSA2048_PRIVATE:
+        {
+ #if HW_SCE_BENCH_HAS_RSA2048
+            err = HW_SCE_Rsa2048ModularExponentDecryptSubAdaptor(NULL, p_keys->p_rsa_private_key_index, NULL, p_in32,
+                                                                 p_out32);
+ #endif
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return err;
+}
+
+#endif
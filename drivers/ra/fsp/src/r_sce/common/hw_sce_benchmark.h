@@ -0,0 +1,144 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#ifndef HW_SCE_BENCHMARK_H
+#define HW_SCE_BENCHMARK_H
+
+/**********************************************************************************************************************
+ * Includes
+ ***********************************************************************************************************************/
+#include "bsp_api.h"
+
+/**********************************************************************************************************************
+ * Macro definitions
+ ***********************************************************************************************************************/
+
+/** Smallest and largest message size accepted by HW_SCE_BenchRun, in bytes. */
+#define HW_SCE_BENCH_MIN_SIZE      (16U)
+#define HW_SCE_BENCH_MAX_SIZE      (65536U)
+
+/** Size of the output buffer needed by the public-key algorithms, in bytes. */
+#define HW_SCE_BENCH_PKA_SIZE      (256U)
+
+/** Column names of the lines written by HW_SCE_BenchFormat. The columns are only ever appended to. */
+#define HW_SCE_BENCH_CSV_HEADER    "alg,size,iterations,err,setup_cycles,process_cycles,cycles_per_byte_x100,ops_per_sec"
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ ***********************************************************************************************************************/
+
+/** Benchmarked algorithms. HW_SCE_BenchRun runs them in this order. */
+typedef enum e_hw_sce_bench_alg
+{
+    HW_SCE_BENCH_ALG_AES128_ECB,       ///< AES-128 ECB encryption
+    HW_SCE_BENCH_ALG_AES128_CBC,       ///< AES-128 CBC encryption
+    HW_SCE_BENCH_ALG_AES128_CTR,       ///< AES-128 CTR encryption
+    HW_SCE_BENCH_ALG_AES128_GCM,       ///< AES-128 GCM encryption, no AAD
+    HW_SCE_BENCH_ALG_AES128_CCM,       ///< AES-128 CCM encryption, no AAD, 16-byte tag
+    HW_SCE_BENCH_ALG_SHA256,           ///< SHA-256 digest
+    HW_SCE_BENCH_ALG_ECDSA_P256_SIGN,  ///< ECDSA P-256 signature of a 32-byte digest
+    HW_SCE_BENCH_ALG_ECDSA_P256_VERIFY, ///< ECDSA P-256 verification of the signature made by the sign step
+    HW_SCE_BENCH_ALG_RSA2048_PUBLIC,   ///< RSA-2048 public key operation
+    HW_SCE_BENCH_ALG_RSA2048_PRIVATE,  ///< RSA-2048 private key operation
+    HW_SCE_BENCH_ALG_NUM,
+} hw_sce_bench_alg_t;
+
+/** Key material passed to the adaptors. Key indexes are wrapped keys in the format of the SCE generation in use. */
+typedef struct st_hw_sce_bench_keys
+{
+    uint32_t * p_aes_key_type;         ///< InData_KeyMode/InData_KeyType word for the AES-128 key
+    uint32_t * p_aes_key_index;        ///< AES-128 key index
+    uint32_t * p_aes_iv;               ///< 16-byte IV for CBC and CTR, 12-byte nonce for GCM and CCM
+    uint32_t * p_ecc_curve_type;       ///< InData_CurveType word for P-256
+    uint32_t * p_ecc_cmd;              ///< InData_Cmd word for P-256
+    uint32_t * p_ecc_private_key_index; ///< P-256 private key index, used to sign
+    uint32_t * p_ecc_public_key_index; ///< P-256 public key index, used to verify
+    uint32_t * p_rsa_public_key_index; ///< RSA-2048 public key index
+    uint32_t * p_rsa_private_key_index; ///< RSA-2048 private key index
+} hw_sce_bench_keys_t;
+
+/** Operations timed by the harness. HW_SCE_BenchRun only calls the engine through this table, so a host build can
+ *  supply its own. */
+typedef struct st_hw_sce_bench_backend
+{
+    /** Called once before the first measurement, for example to start the cycle counter. May be NULL. */
+    void (* p_open)(void);
+
+    /** Sets up one operation on size bytes: key and IV loading, mode selection. Timed as setup overhead. */
+    fsp_err_t (* p_setup)(hw_sce_bench_alg_t alg, hw_sce_bench_keys_t const * p_keys, uint32_t size);
+
+    /** Processes size bytes from p_in into p_out and completes the operation started by p_setup. */
+    fsp_err_t (* p_process)(hw_sce_bench_alg_t alg, hw_sce_bench_keys_t const * p_keys, uint8_t const * p_in,
+                            uint8_t * p_out, uint32_t size);
+
+    /** Returns a free-running 32-bit cycle count. */
+    uint32_t (* p_cycles)(void);
+} hw_sce_bench_backend_t;
+
+/** Benchmark configuration */
+typedef struct st_hw_sce_bench_cfg
+{
+    hw_sce_bench_backend_t const * p_backend; ///< Backend, normally &g_hw_sce_bench_adaptor
+    hw_sce_bench_keys_t const    * p_keys;    ///< Key material
+    uint32_t alg_mask;                 ///< Bit n set runs hw_sce_bench_alg_t n
+    uint32_t min_size;                 ///< First message size, a multiple of 16 bytes
+    uint32_t max_size;                 ///< Last message size. Sizes double from min_size up to max_size.
+    uint32_t iterations;               ///< Operations timed for each algorithm and size
+    uint8_t * p_in;                    ///< Word-aligned input buffer of max_size bytes
+    uint8_t * p_out;                   ///< Word-aligned output buffer of max_size bytes, at least HW_SCE_BENCH_PKA_SIZE
+} hw_sce_bench_cfg_t;
+
+/** Measurement for one algorithm and message size */
+typedef struct st_hw_sce_bench_result
+{
+    hw_sce_bench_alg_t alg;            ///< Algorithm
+    uint32_t           size;           ///< Bytes processed by each operation
+    uint32_t           iterations;     ///< Operations completed
+    fsp_err_t          err;            ///< FSP_SUCCESS, or the error that stopped the measurement
+    uint64_t           setup_cycles;   ///< Cycles spent in p_setup, summed over the operations
+    uint64_t           process_cycles; ///< Cycles spent in p_process, summed over the operations
+} hw_sce_bench_result_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ ***********************************************************************************************************************/
+
+/** Backend calling the r_sce_adapt.c adaptors of the SCE generation the MCU has. */
+extern const hw_sce_bench_backend_t g_hw_sce_bench_adaptor;
+
+/**********************************************************************************************************************
+ * Function Prototypes
+ ***********************************************************************************************************************/
+
+/**
+ * @brief Run the selected algorithms over the configured message sizes
+ * @param[in] p_cfg Configuration
+ * @param[out] p_results Results, one per algorithm and size
+ * @param[in] max_results Number of entries in p_results
+ * @param[out] p_count Number of results written
+ */
+fsp_err_t HW_SCE_BenchRun(hw_sce_bench_cfg_t const * p_cfg,
+                          hw_sce_bench_result_t    * p_results,
+                          uint32_t                   max_results,
+                          uint32_t                 * p_count);
+
+/**
+ * @brief Format one result as a line of HW_SCE_BENCH_CSV_HEADER columns
+ * @param[in] p_result Result
+ * @param[in] core_hz CPU clock the cycles were counted at, normally SystemCoreClock
+ * @param[out] p_buf Destination, NUL terminated
+ * @param[in] size Size of p_buf in bytes
+ * @return Length of the line, or 0 if it does not fit
+ */
+uint32_t HW_SCE_BenchFormat(hw_sce_bench_result_t const * p_result, uint32_t core_hz, char * p_buf, uint32_t size);
+
+/**
+ * @brief Get the name used for an algorithm in the alg column
+ * @param[in] alg Algorithm
+ */
+char const * HW_SCE_BenchAlgName(hw_sce_bench_alg_t alg);
+
+#endif                                 /* HW_SCE_BENCHMARK_H */
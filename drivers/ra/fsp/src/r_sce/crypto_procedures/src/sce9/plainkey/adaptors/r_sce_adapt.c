@@ -142,12 +142,20 @@ fsp_err_t HW_SCE_McuSpecificInit (void)
     return iret;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_GenerateRandomNumberSub with the engine lock held.
+ *
+ * @retval FSP_SUCCESS                 OutData_Text holds four random words.
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @retval FSP_ERR_CRYPTO_SCE_FAIL     The procedure failed.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_RNG_Read (uint32_t * OutData_Text)
 {
-    if (FSP_SUCCESS != HW_SCE_GenerateRandomNumberSub(OutData_Text))
-    {
-        return FSP_ERR_CRYPTO_SCE_FAIL;
-    }
+    fsp_err_t err;
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_GenerateRandomNumberSub(OutData_Text));
+    FSP_ERROR_RETURN(FSP_ERR_IN_USE != err, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, FSP_ERR_CRYPTO_SCE_FAIL);
 
     return FSP_SUCCESS;
 }
@@ -179,15 +187,31 @@ fsp_err_t HW_SCE_GenerateOemKeyIndexPrivate (const sce_oem_key_type_t key_type,
 }
 
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Ghash with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Ghash.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_GhashSub (uint32_t *InData_HV, 
                            uint32_t *InData_IV, 
                            uint32_t *InData_Text, 
                            uint32_t *OutData_DataT, 
                            uint32_t MAX_CNT)
 {
-    return HW_SCE_Ghash(InData_HV, InData_IV, InData_Text, OutData_DataT, MAX_CNT);
+    fsp_err_t err;
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Ghash(InData_HV, InData_IV, InData_Text, OutData_DataT, MAX_CNT));
+
+    return err;
 } 
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Sha224256GenerateMessageDigestSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Sha224256GenerateMessageDigestSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_ShaGenerateMessageDigestSub(const uint32_t InData_HashType[],
                                              const uint32_t InData_Cmd[],
                                              const uint32_t InData_Msg[],
@@ -197,15 +221,19 @@ fsp_err_t HW_SCE_ShaGenerateMessageDigestSub(const uint32_t InData_HashType[],
                                              uint32_t OutData_State[],
                                              const uint32_t MAX_CNT)
 {   
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_HashType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(OutData_State);
     FSP_PARAMETER_NOT_USED(InData_MsgLen);
 
-    return HW_SCE_Sha224256GenerateMessageDigestSub(InData_State,
-                                                    InData_Msg,
-                                                    MAX_CNT,
-                                                    OutData_MsgDigest);
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Sha224256GenerateMessageDigestSub(InData_State,
+                                                                     InData_Msg,
+                                                                     MAX_CNT,
+                                                                     OutData_MsgDigest));
+
+    return err;
 }
 
 fsp_err_t HW_SCE_ShaGenerateMessageDigestSubGeneral(const uint32_t InData_HashType[],
@@ -227,41 +255,85 @@ uint32_t change_endian_long (uint32_t a)
 {
     return __REV(a);
 }
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128EncryptDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128EncryptDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128EncryptDecryptInitSubAdaptor (const uint32_t InData_KeyMode[],
                                               const uint32_t InData_Cmd[],
                                               const uint32_t InData_KeyIndex[],
                                               const uint32_t InData_Key[],
                                               const uint32_t InData_IV[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Aes128EncryptDecryptInitSub(InData_KeyMode, InData_Cmd, InData_KeyIndex, InData_IV);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128EncryptDecryptInitSub(InData_KeyMode, InData_Cmd, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes192EncryptDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes192EncryptDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes192EncryptDecryptInitSubAdaptor (const uint32_t InData_KeyMode[],
 		                                             const uint32_t InData_Cmd[],
 		                                             const uint32_t InData_KeyIndex[],
 		                                             const uint32_t InData_Key[],
 		                                             const uint32_t InData_IV[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyMode);
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Aes192EncryptDecryptInitSub(InData_Cmd, InData_KeyIndex, InData_IV);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes192EncryptDecryptInitSub(InData_Cmd, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256EncryptDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256EncryptDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256EncryptDecryptInitSubAdaptor (const uint32_t InData_KeyMode[],
                                               const uint32_t InData_Cmd[],
                                               const uint32_t InData_KeyIndex[],
                                               const uint32_t InData_Key[],
                                               const uint32_t InData_IV[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Aes256EncryptDecryptInitSub(InData_KeyMode, InData_Cmd, InData_KeyIndex, InData_IV);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256EncryptDecryptInitSub(InData_KeyMode, InData_Cmd, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128CmacInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128CmacInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128CmacInit(const uint32_t InData_KeyType[], const uint32_t InData_KeyIndex[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
-    return HW_SCE_Aes128CmacInitSub((uint32_t *)InData_KeyIndex);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128CmacInitSub((uint32_t *)InData_KeyIndex));
+
+    return err;
 }
 
 fsp_err_t HW_SCE_Aes192CmacInit(const uint32_t InData_KeyType[], const uint32_t InData_KeyIndex[])
@@ -271,10 +343,21 @@ fsp_err_t HW_SCE_Aes192CmacInit(const uint32_t InData_KeyType[], const uint32_t
     return FSP_ERR_UNSUPPORTED;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256CmacInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256CmacInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256CmacInit(const uint32_t InData_KeyType[], const uint32_t InData_KeyIndex[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
-    return HW_SCE_Aes256CmacInitSub((uint32_t *)InData_KeyIndex);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256CmacInitSub((uint32_t *)InData_KeyIndex));
+
+    return err;
 }
 
 void HW_SCE_Aes128CmacUpdate(const uint32_t InData_Text[], const uint32_t MAX_CNT)
@@ -327,6 +410,12 @@ fsp_err_t HW_SCE_Aes256CmacFinal(const uint32_t InData_Cmd[],
                                     (uint32_t *)InData_DataTLen, OutData_DataT);
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128CcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128CcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -337,11 +426,21 @@ fsp_err_t HW_SCE_Aes128CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
-    return (HW_SCE_Aes128CcmEncryptInitSub(InData_KeyType, InData_DataType, InData_Cmd, InData_TextLen,
-                                           InData_KeyIndex, InData_IV, InData_Header, Header_Len,
-                                           InData_SeqNum));
+    fsp_err_t err;
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128CcmEncryptInitSub(InData_KeyType, InData_DataType, InData_Cmd, InData_TextLen,
+                                                           InData_KeyIndex, InData_IV, InData_Header, Header_Len,
+                                                           InData_SeqNum));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes192CcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes192CcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes192CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -352,15 +451,25 @@ fsp_err_t HW_SCE_Aes192CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_TextLen);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return (HW_SCE_Aes192CcmEncryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes192CcmEncryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256CcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256CcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -371,15 +480,25 @@ fsp_err_t HW_SCE_Aes256CcmEncryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_TextLen);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
-    
-    return (HW_SCE_Aes256CcmEncryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256CcmEncryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128CcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128CcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -391,11 +510,21 @@ fsp_err_t HW_SCE_Aes128CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
-    return (HW_SCE_Aes128CcmDecryptInitSub(InData_KeyType, InData_DataType, InData_Cmd, InData_TextLen,
-                                           InData_MACLength, InData_KeyIndex, InData_IV, InData_Header,
-                                           Header_Len, InData_SeqNum));
+    fsp_err_t err;
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128CcmDecryptInitSub(InData_KeyType, InData_DataType, InData_Cmd, InData_TextLen,
+                                                           InData_MACLength, InData_KeyIndex, InData_IV, InData_Header,
+                                                           Header_Len, InData_SeqNum));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes192CcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes192CcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes192CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -407,6 +536,8 @@ fsp_err_t HW_SCE_Aes192CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
@@ -414,9 +545,17 @@ fsp_err_t HW_SCE_Aes192CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
     FSP_PARAMETER_NOT_USED(InData_MACLength);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return (HW_SCE_Aes192CcmDecryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes192CcmDecryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256CcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256CcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_DataType[],
                                                  uint32_t InData_Cmd[],
@@ -428,13 +567,18 @@ fsp_err_t HW_SCE_Aes256CcmDecryptInitSubGeneral (uint32_t InData_KeyType[],
                                                  uint32_t InData_SeqNum[],
                                                  uint32_t Header_Len)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_TextLen);
     FSP_PARAMETER_NOT_USED(InData_MACLength);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
-    return (HW_SCE_Aes256CcmDecryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256CcmDecryptInitSub(InData_KeyIndex, InData_IV, InData_Header, Header_Len));
+
+    return err;
 }
 
 fsp_err_t HW_SCE_Aes128CcmEncryptFinalSubGeneral (const uint32_t *InData_Text, const uint32_t *InData_TextLen, uint32_t *OutData_Text, uint32_t *OutData_MAC)
@@ -454,6 +598,12 @@ fsp_err_t HW_SCE_Aes128CcmDecryptFinalSubGeneral(const uint32_t *InData_Text,
     return (HW_SCE_Aes128CcmDecryptFinalSub(InData_Text, InData_MAC, OutData_Text));
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128GcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128GcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_DataType, 
                                                  uint32_t * InData_Cmd, 
@@ -461,13 +611,23 @@ fsp_err_t HW_SCE_Aes128GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV, 
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return (HW_SCE_Aes128GcmEncryptInitSub (InData_KeyType, InData_KeyIndex, InData_IV));
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128GcmEncryptInitSub (InData_KeyType, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128GcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128GcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128GcmDecryptInitSubGeneral (uint32_t * InData_KeyType, 
                                                  uint32_t * InData_DataType, 
                                                  uint32_t * InData_Cmd,
@@ -475,13 +635,23 @@ fsp_err_t HW_SCE_Aes128GcmDecryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV, 
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return (HW_SCE_Aes128GcmDecryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV));
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128GcmDecryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes192GcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes192GcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes192GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_DataType,
                                                  uint32_t * InData_Cmd,
@@ -489,14 +659,24 @@ fsp_err_t HW_SCE_Aes192GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV,
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return HW_SCE_Aes192GcmEncryptInitSub(InData_KeyIndex, InData_IV);
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes192GcmEncryptInitSub(InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes192GcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes192GcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes192GcmDecryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_DataType,
                                                  uint32_t * InData_Cmd,
@@ -504,14 +684,24 @@ fsp_err_t HW_SCE_Aes192GcmDecryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV,
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyType);
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return HW_SCE_Aes192GcmDecryptInitSub(InData_KeyIndex, InData_IV);
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes192GcmDecryptInitSub(InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256GcmEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256GcmEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_DataType,
                                                  uint32_t * InData_Cmd,
@@ -519,13 +709,23 @@ fsp_err_t HW_SCE_Aes256GcmEncryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV,
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return HW_SCE_Aes256GcmEncryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV);
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256GcmEncryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes256GcmDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes256GcmDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes256GcmDecryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_DataType,
                                                  uint32_t * InData_Cmd,
@@ -533,33 +733,65 @@ fsp_err_t HW_SCE_Aes256GcmDecryptInitSubGeneral (uint32_t * InData_KeyType,
                                                  uint32_t * InData_IV,
                                                  uint32_t * InData_SeqNum)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_DataType);
     FSP_PARAMETER_NOT_USED(InData_Cmd);
     FSP_PARAMETER_NOT_USED(InData_SeqNum);
 
-    return HW_SCE_Aes256GcmDecryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV);
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes256GcmDecryptInitSub(InData_KeyType, InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128XtsEncryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128XtsEncryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128XtsEncryptInitSubGeneral (uint32_t InData_KeyMode[],
                                                  uint32_t InData_KeyIndex[],
                                                  uint32_t InData_Key[],
                                                  uint32_t InData_IV[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyMode);
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Aes128XtsEncryptInitSub(InData_KeyIndex, InData_IV);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128XtsEncryptInitSub(InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Aes128XtsDecryptInitSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Aes128XtsDecryptInitSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Aes128XtsDecryptInitSubGeneral (uint32_t InData_KeyMode[],
                                                  uint32_t InData_KeyIndex[],
                                                  uint32_t InData_Key[],
                                                  uint32_t InData_IV[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyMode);
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Aes128XtsDecryptInitSub(InData_KeyIndex, InData_IV);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Aes128XtsDecryptInitSub(InData_KeyIndex, InData_IV));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Ecc256ScalarMultiplicationSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Ecc256ScalarMultiplicationSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Ecc256ScalarMultiplicationSubAdaptor(const uint32_t InData_CurveType[],
                                                       const uint32_t InData_Cmd[],
                                                       const uint32_t InData_KeyIndex[],
@@ -567,10 +799,22 @@ fsp_err_t HW_SCE_Ecc256ScalarMultiplicationSubAdaptor(const uint32_t InData_Curv
                                                       const uint32_t InData_DomainParam[],
                                                       uint32_t OutData_R[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
-    return (HW_SCE_Ecc256ScalarMultiplicationSub(InData_CurveType, InData_Cmd, InData_KeyIndex, InData_PubKey,  OutData_R));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Ecc256ScalarMultiplicationSub(InData_CurveType, InData_Cmd, InData_KeyIndex,
+                                                                 InData_PubKey, OutData_R));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Ecc384ScalarMultiplicationSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Ecc384ScalarMultiplicationSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Ecc384ScalarMultiplicationSubAdaptor(const uint32_t InData_CurveType[],
                                                       const uint32_t InData_Cmd[],
                                                       const uint32_t InData_KeyIndex[],
@@ -578,9 +822,15 @@ fsp_err_t HW_SCE_Ecc384ScalarMultiplicationSubAdaptor(const uint32_t InData_Curv
                                                       const uint32_t InData_DomainParam[],
                                                       uint32_t OutData_R[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
     FSP_PARAMETER_NOT_USED (InData_Cmd);
-    return (HW_SCE_Ecc384ScalarMultiplicationSub(InData_CurveType, InData_KeyIndex, InData_PubKey, OutData_R));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Ecc384ScalarMultiplicationSub(InData_CurveType, InData_KeyIndex, InData_PubKey,
+                                                                 OutData_R));
+
+    return err;
 }
 
 fsp_err_t HW_SCE_EccEd25519ScalarMultiplicationSubAdaptor(const uint32_t InData_CurveType[],
@@ -599,6 +849,12 @@ fsp_err_t HW_SCE_EccEd25519ScalarMultiplicationSubAdaptor(const uint32_t InData_
 	return FSP_ERR_UNSUPPORTED;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_EcdsaSignatureGenerateSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_EcdsaSignatureGenerateSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_EcdsaSignatureGenerateSubAdaptor(const uint32_t InData_CurveType[],
                                                   const uint32_t InData_Cmd[],
                                                   const uint32_t InData_KeyIndex[],
@@ -606,20 +862,44 @@ fsp_err_t HW_SCE_EcdsaSignatureGenerateSubAdaptor(const uint32_t InData_CurveTyp
                                                   const uint32_t InData_DomainParam[],
                                                   uint32_t OutData_Signature[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
-    return (HW_SCE_EcdsaSignatureGenerateSub(InData_CurveType, InData_Cmd, InData_KeyIndex, InData_MsgDgst, OutData_Signature));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_EcdsaSignatureGenerateSub(InData_CurveType, InData_Cmd, InData_KeyIndex,
+                                                             InData_MsgDgst, OutData_Signature));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_EcdsaP384SignatureGenerateSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_EcdsaP384SignatureGenerateSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_EcdsaP384SignatureGenerateSubAdaptor(const uint32_t InData_CurveType[], 
                                                       const uint32_t InData_KeyIndex[],
                                                       const uint32_t InData_MsgDgst[],
                                                       const uint32_t InData_DomainParam[],
                                                       uint32_t OutData_Signature[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
-    return (HW_SCE_EcdsaP384SignatureGenerateSub(InData_CurveType, InData_KeyIndex, InData_MsgDgst, OutData_Signature));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_EcdsaP384SignatureGenerateSub(InData_CurveType, InData_KeyIndex, InData_MsgDgst,
+                                                                 OutData_Signature));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_EcdsaSignatureVerificationSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_EcdsaSignatureVerificationSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_EcdsaSignatureVerificationSubAdaptor(const uint32_t InData_CurveType[],
                                                   const uint32_t InData_Cmd[],
                                                   const uint32_t InData_KeyIndex[],
@@ -628,11 +908,23 @@ fsp_err_t HW_SCE_EcdsaSignatureVerificationSubAdaptor(const uint32_t InData_Curv
                                                   const uint32_t InData_Signature[],
                                                   const uint32_t InData_DomainParam[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
     FSP_PARAMETER_NOT_USED (InData_Key);
-    return (HW_SCE_EcdsaSignatureVerificationSub(InData_CurveType, InData_Cmd, InData_KeyIndex, InData_MsgDgst, InData_Signature));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_EcdsaSignatureVerificationSub(InData_CurveType, InData_Cmd, InData_KeyIndex,
+                                                                 InData_MsgDgst, InData_Signature));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_EcdsaP384SignatureVerificationSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_EcdsaP384SignatureVerificationSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_EcdsaP384SignatureVerificationSubAdaptor(const uint32_t InData_CurveType[],
                                                           const uint32_t InData_KeyIndex[],
                                                           const uint32_t InData_Key[],
@@ -640,11 +932,23 @@ fsp_err_t HW_SCE_EcdsaP384SignatureVerificationSubAdaptor(const uint32_t InData_
                                                           const uint32_t InData_Signature[],
                                                           const uint32_t InData_DomainParam[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
     FSP_PARAMETER_NOT_USED (InData_Key);
-    return (HW_SCE_EcdsaP384SignatureVerificationSub(InData_CurveType, InData_KeyIndex, InData_MsgDgst, InData_Signature));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_EcdsaP384SignatureVerificationSub(InData_CurveType, InData_KeyIndex, InData_MsgDgst,
+                                                                     InData_Signature));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_GenerateEccRandomKeyIndexSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_GenerateEccRandomKeyIndexSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_GenerateEccRandomKeyIndexSubAdaptor(const uint32_t *InData_CurveType,
                                                      const uint32_t *InData_Cmd,
                                                      const uint32_t *InData_KeyType,
@@ -654,10 +958,23 @@ fsp_err_t HW_SCE_GenerateEccRandomKeyIndexSubAdaptor(const uint32_t *InData_Curv
                                                      uint32_t *OutData_PrivKeyIndex,
                                                      uint32_t *OutData_PrivKey)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
-    return (HW_SCE_GenerateEccRandomKeyIndexSub(InData_CurveType, InData_Cmd, InData_KeyType, OutData_PubKeyIndex, OutData_PubKey, OutData_PrivKeyIndex, OutData_PrivKey));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_GenerateEccRandomKeyIndexSub(InData_CurveType, InData_Cmd, InData_KeyType,
+                                                                OutData_PubKeyIndex, OutData_PubKey,
+                                                                OutData_PrivKeyIndex, OutData_PrivKey));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_GenerateEccP384RandomKeyIndexSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_GenerateEccP384RandomKeyIndexSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_GenerateEccP384RandomKeyIndexSubAdaptor(const uint32_t *InData_CurveType,
                                                          const uint32_t *InData_KeyType,
                                                          const uint32_t InData_DomainParam[],
@@ -666,70 +983,154 @@ fsp_err_t HW_SCE_GenerateEccP384RandomKeyIndexSubAdaptor(const uint32_t *InData_
                                                          uint32_t *OutData_PrivKeyIndex,
                                                          uint32_t *OutData_PrivKey)
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_DomainParam);
-    
-    return (HW_SCE_GenerateEccP384RandomKeyIndexSub(InData_CurveType, InData_KeyType, OutData_PubKeyIndex, OutData_PubKey, OutData_PrivKeyIndex, OutData_PrivKey));
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_GenerateEccP384RandomKeyIndexSub(InData_CurveType, InData_KeyType,
+                                                                    OutData_PubKeyIndex, OutData_PubKey,
+                                                                    OutData_PrivKeyIndex, OutData_PrivKey));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Sha224256GenerateMessageDigestSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Sha224256GenerateMessageDigestSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_ShaGenerateMessageDigestSubAdaptor (const uint32_t InData_InitVal[], const uint32_t InData_PaddedMsg[], uint32_t OutData_MsgDigest[], const uint32_t MAX_CNT)
 {
-    return HW_SCE_Sha224256GenerateMessageDigestSub(InData_InitVal, InData_PaddedMsg, MAX_CNT, OutData_MsgDigest);
+    fsp_err_t err;
+
+    HW_SCE_ENGINE_CALL(err,
+                       HW_SCE_Sha224256GenerateMessageDigestSub(InData_InitVal, InData_PaddedMsg, MAX_CNT,
+                                                                OutData_MsgDigest));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa1024ModularExponentDecryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa1024ModularExponentDecryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa1024ModularExponentDecryptSubAdaptor(const uint32_t InData_KeyMode[],
                                                          uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_KeyMode);
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Rsa1024ModularExponentDecryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa1024ModularExponentDecryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa2048ModularExponentDecryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa2048ModularExponentDecryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa2048ModularExponentDecryptSubAdaptor(const uint32_t InData_KeyMode[],
                                                          uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED (InData_KeyMode);
     FSP_PARAMETER_NOT_USED (InData_Key);
-    return HW_SCE_Rsa2048ModularExponentDecryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa2048ModularExponentDecryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa1024ModularExponentEncryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa1024ModularExponentEncryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa1024ModularExponentEncryptSubAdaptor(const uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Rsa1024ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa1024ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa2048ModularExponentEncryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa2048ModularExponentEncryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa2048ModularExponentEncryptSubAdaptor(const uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Rsa2048ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa2048ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa3072ModularExponentEncryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa3072ModularExponentEncryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa3072ModularExponentEncryptSubAdaptor(const uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Rsa3072ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa3072ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
 
+/*******************************************************************************************************************//**
+ * Runs HW_SCE_Rsa4096ModularExponentEncryptSub with the engine lock held.
+ *
+ * @retval FSP_ERR_IN_USE              The engine is owned by another caller, see HW_SCE_EngineLock.
+ * @return Otherwise the result of HW_SCE_Rsa4096ModularExponentEncryptSub.
+ **********************************************************************************************************************/
 fsp_err_t HW_SCE_Rsa4096ModularExponentEncryptSubAdaptor(const uint32_t InData_KeyIndex[],
                                                          const uint32_t InData_Key[],
                                                          const uint32_t InData_Text[],
                                                          uint32_t OutData_Text[])
 {
+    fsp_err_t err;
+
     FSP_PARAMETER_NOT_USED(InData_Key);
-    return HW_SCE_Rsa4096ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text);
+
+    HW_SCE_ENGINE_CALL(err, HW_SCE_Rsa4096ModularExponentEncryptSub(InData_KeyIndex, InData_Text, OutData_Text));
+
+    return err;
 }
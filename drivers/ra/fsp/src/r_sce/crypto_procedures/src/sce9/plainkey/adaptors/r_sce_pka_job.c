@@ -0,0 +1,446 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "hw_sce_ra_private.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_pka_job_run(hw_sce_pka_job_t * p_job);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* Jobs waiting for the engine, oldest first. */
+static hw_sce_pka_job_t * gp_pka_job_head = NULL;
+static hw_sce_pka_job_t * gp_pka_job_tail = NULL;
+
+/* Set while a caller owns the engine. */
+static volatile bool g_sce_engine_locked = false;
+
+/* Optional functions that let callers of HW_SCE_EngineLock wait for the engine, typically an RTOS mutex. */
+static fsp_err_t (* gp_sce_engine_take)(void * p_context) = NULL;
+static void (* gp_sce_engine_give)(void * p_context)       = NULL;
+static void * gp_sce_engine_context                        = NULL;
+
+/* Called after a job is queued so the thread draining the queue can be woken. */
+static void (* gp_pka_job_notify)(void * p_context) = NULL;
+static void * gp_pka_job_notify_context             = NULL;
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Sets the functions HW_SCE_EngineLock uses to wait for the engine. p_take must block until p_give is called by the
+ * current owner, as taking an RTOS mutex without timeout does, and return FSP_SUCCESS. In a context that cannot block,
+ * such as an interrupt, p_take must return FSP_ERR_IN_USE instead. Call this function before any SCE procedure runs.
+ * Set p_take and p_give to NULL to remove them; HW_SCE_EngineLock then never waits.
+ *
+ * @param[in] p_take     Waits for the engine
+ * @param[in] p_give     Wakes the next caller waiting in p_take
+ * @param[in] p_context  Passed to p_take and p_give
+ **********************************************************************************************************************/
+void HW_SCE_EngineLockHookSet (fsp_err_t (* p_take)(void * p_context), void (* p_give)(void * p_context),
+                               void * p_context)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    gp_sce_engine_take    = p_take;
+    gp_sce_engine_give    = p_give;
+    gp_sce_engine_context = p_context;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Takes ownership of the engine. HW_SCE_PkaJobProcess owns the engine for the whole job, and the SCE9 AES, GHASH, SHA,
+ * random number, ECC and RSA adaptors own it for the duration of their procedure.
+ *
+ * When HW_SCE_EngineLockHookSet has set a wait function, the caller waits until the engine is free. Otherwise, and in
+ * contexts where the wait function cannot block, the lock is taken without waiting.
+ *
+ * Multi-step AES operations only take the lock for their Init step. The engine itself then refuses to start any other
+ * procedure (FSP_ERR_CRYPTO_SCE_RESOURCE_CONFLICT) until the Final step, which HW_SCE_PkaJobProcess handles by leaving
+ * the job queued.
+ *
+ * @retval FSP_SUCCESS           The caller owns the engine and must call HW_SCE_EngineUnlock.
+ * @retval FSP_ERR_IN_USE        A public-key job or another caller owns the engine and the caller cannot wait.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_EngineLock (void)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    fsp_err_t (* p_take)(void * p_context) = gp_sce_engine_take;
+    void (* p_give)(void * p_context)      = gp_sce_engine_give;
+    void * p_context = gp_sce_engine_context;
+
+    if (NULL != p_take)
+    {
+        err = p_take(p_context);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        err = FSP_ERR_IN_USE;
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        /* An interrupt that could not wait may still own the engine. */
+        if (!g_sce_engine_locked)
+        {
+            g_sce_engine_locked = true;
+            err                 = FSP_SUCCESS;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if ((FSP_SUCCESS != err) && (NULL != p_give))
+        {
+            p_give(p_context);
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Releases the engine taken with HW_SCE_EngineLock and wakes the next caller waiting for it.
+ **********************************************************************************************************************/
+void HW_SCE_EngineUnlock (void)
+{
+    g_sce_engine_locked = false;
+
+    if (NULL != gp_sce_engine_give)
+    {
+        gp_sce_engine_give(gp_sce_engine_context);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Sets the function called each time a job is queued. The function is typically used to give a semaphore that the
+ * thread calling HW_SCE_PkaJobProcess waits on. It may be called from any context that submits jobs and must not
+ * block. Set p_notify to NULL to remove it.
+ *
+ * @param[in] p_notify   Function called after a job is queued
+ * @param[in] p_context  Passed to p_notify
+ **********************************************************************************************************************/
+void HW_SCE_PkaJobNotifySet (void (* p_notify)(void * p_context), void * p_context)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    gp_pka_job_notify         = p_notify;
+    gp_pka_job_notify_context = p_context;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Queues a public-key job. The job and every buffer it references must stay valid until the callback is called.
+ * Jobs are run in the order they are submitted by HW_SCE_PkaJobProcess.
+ *
+ * @param[in] p_job  Job to queue
+ *
+ * @retval FSP_SUCCESS           The job is queued.
+ * @retval FSP_ERR_ASSERTION     p_job is NULL, has no callback or its operation is not valid.
+ * @retval FSP_ERR_IN_USE        The job is already queued or running.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_PkaJobSubmit (hw_sce_pka_job_t * const p_job)
+{
+    FSP_ERROR_RETURN(NULL != p_job, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_job->p_callback, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(HW_SCE_PKA_OP_NUM > p_job->op, FSP_ERR_ASSERTION);
+
+    void (* p_notify)(void * p_context) = NULL;
+    void * p_notify_context = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((HW_SCE_PKA_JOB_STATE_QUEUED == p_job->state) || (HW_SCE_PKA_JOB_STATE_RUNNING == p_job->state))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_IN_USE;
+    }
+
+    p_job->p_next = NULL;
+    p_job->state  = HW_SCE_PKA_JOB_STATE_QUEUED;
+    p_job->result = FSP_SUCCESS;
+
+    if (NULL == gp_pka_job_tail)
+    {
+        gp_pka_job_head = p_job;
+    }
+    else
+    {
+        gp_pka_job_tail->p_next = p_job;
+    }
+
+    gp_pka_job_tail = p_job;
+
+    p_notify         = gp_pka_job_notify;
+    p_notify_context = gp_pka_job_notify_context;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_notify)
+    {
+        p_notify(p_notify_context);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Removes a job from the queue before it starts. A job that is already running cannot be cancelled; its callback is
+ * still called when it completes.
+ *
+ * @param[in] p_job  Job to remove
+ *
+ * @retval FSP_SUCCESS           The job is removed. Its callback is not called.
+ * @retval FSP_ERR_ASSERTION     p_job is NULL.
+ * @retval FSP_ERR_NOT_FOUND     The job is not queued.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_PkaJobCancel (hw_sce_pka_job_t * const p_job)
+{
+    FSP_ERROR_RETURN(NULL != p_job, FSP_ERR_ASSERTION);
+
+    fsp_err_t          err    = FSP_ERR_NOT_FOUND;
+    hw_sce_pka_job_t * p_prev = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (hw_sce_pka_job_t * p_cur = gp_pka_job_head; NULL != p_cur; p_cur = p_cur->p_next)
+    {
+        if (p_cur == p_job)
+        {
+            if (NULL == p_prev)
+            {
+                gp_pka_job_head = p_job->p_next;
+            }
+            else
+            {
+                p_prev->p_next = p_job->p_next;
+            }
+
+            if (gp_pka_job_tail == p_job)
+            {
+                gp_pka_job_tail = p_prev;
+            }
+
+            p_job->p_next = NULL;
+            p_job->state  = HW_SCE_PKA_JOB_STATE_IDLE;
+            err           = FSP_SUCCESS;
+            break;
+        }
+
+        p_prev = p_cur;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Runs the oldest queued job, then calls its callback. Call this function from one thread only. The caller is blocked
+ * while the job runs, and owns the engine through HW_SCE_EngineLock for that time. SCE9 adaptors called meanwhile from
+ * other threads wait in HW_SCE_EngineLock when HW_SCE_EngineLockHookSet has set a wait function. Without one, and from
+ * interrupts, they return FSP_ERR_IN_USE instead of corrupting the job.
+ *
+ * The job is left queued, and its callback is not called, when the engine is not free: another caller holds the lock
+ * and this thread cannot wait for it, or a multi-step AES operation is between its Init and Final steps. Call this
+ * function again later in that case.
+ *
+ * @return Number of jobs still queued.
+ **********************************************************************************************************************/
+uint32_t HW_SCE_PkaJobProcess (void)
+{
+    hw_sce_pka_job_t * p_job   = NULL;
+    uint32_t           pending = 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+
+    if (FSP_SUCCESS == HW_SCE_EngineLock())
+    {
+        FSP_CRITICAL_SECTION_ENTER;
+
+        p_job = gp_pka_job_head;
+        if (NULL != p_job)
+        {
+            gp_pka_job_head = p_job->p_next;
+            if (NULL == gp_pka_job_head)
+            {
+                gp_pka_job_tail = NULL;
+            }
+
+            p_job->p_next = NULL;
+            p_job->state  = HW_SCE_PKA_JOB_STATE_RUNNING;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (NULL != p_job)
+        {
+            fsp_err_t err = hw_sce_pka_job_run(p_job);
+
+            if (FSP_ERR_CRYPTO_SCE_RESOURCE_CONFLICT == err)
+            {
+                /* A multi-step operation is open on the engine. Put the job back in front of the queue. */
+                FSP_CRITICAL_SECTION_ENTER;
+                p_job->p_next   = gp_pka_job_head;
+                p_job->state    = HW_SCE_PKA_JOB_STATE_QUEUED;
+                gp_pka_job_head = p_job;
+                if (NULL == gp_pka_job_tail)
+                {
+                    gp_pka_job_tail = p_job;
+                }
+
+                FSP_CRITICAL_SECTION_EXIT;
+
+                p_job = NULL;
+            }
+            else
+            {
+                p_job->result = err;
+                p_job->state  = HW_SCE_PKA_JOB_STATE_DONE;
+            }
+        }
+
+        HW_SCE_EngineUnlock();
+
+        /* The callback runs without the lock so that it may use the engine or submit another job. */
+        if (NULL != p_job)
+        {
+            p_job->p_callback(p_job);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_ENTER;
+    for (hw_sce_pka_job_t * p_cur = gp_pka_job_head; NULL != p_cur; p_cur = p_cur->p_next)
+    {
+        pending++;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return pending;
+}
+
+/*******************************************************************************************************************//**
+ * Runs one job on the engine. The caller holds the engine lock, so the procedures are called directly rather than
+ * through their adaptors, which take the lock themselves.
+ *
+ * @param[in] p_job  Job to run
+ *
+ * @return Result of the SCE procedure.
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_pka_job_run (hw_sce_pka_job_t * p_job)
+{
+    fsp_err_t err = FSP_ERR_UNSUPPORTED;
+
+    switch (p_job->op)
+    {
+        case HW_SCE_PKA_OP_ECDSA_SIGN:
+        {
+            err = HW_SCE_EcdsaSignatureGenerateSub(p_job->p_curve_type, p_job->p_cmd, p_job->p_key_index,
+                                                   p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_ECDSA_P384_SIGN:
+        {
+            err = HW_SCE_EcdsaP384SignatureGenerateSub(p_job->p_curve_type, p_job->p_key_index, p_job->p_input,
+                                                       p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_ECDSA_VERIFY:
+        {
+            err = HW_SCE_EcdsaSignatureVerificationSub(p_job->p_curve_type, p_job->p_cmd, p_job->p_key_index,
+                                                       p_job->p_input, p_job->p_signature);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_ECDSA_P384_VERIFY:
+        {
+            err = HW_SCE_EcdsaP384SignatureVerificationSub(p_job->p_curve_type, p_job->p_key_index, p_job->p_input,
+                                                           p_job->p_signature);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_ECC256_SCALAR_MULT:
+        {
+            err = HW_SCE_Ecc256ScalarMultiplicationSub(p_job->p_curve_type, p_job->p_cmd, p_job->p_key_index,
+                                                       p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_ECC384_SCALAR_MULT:
+        {
+            err = HW_SCE_Ecc384ScalarMultiplicationSub(p_job->p_curve_type, p_job->p_key_index, p_job->p_input,
+                                                       p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA1024_PUBLIC:
+        {
+            err = HW_SCE_Rsa1024ModularExponentEncryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA2048_PUBLIC:
+        {
+            err = HW_SCE_Rsa2048ModularExponentEncryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA3072_PUBLIC:
+        {
+            err = HW_SCE_Rsa3072ModularExponentEncryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA4096_PUBLIC:
+        {
+            err = HW_SCE_Rsa4096ModularExponentEncryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA1024_PRIVATE:
+        {
+            err = HW_SCE_Rsa1024ModularExponentDecryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        case HW_SCE_PKA_OP_RSA2048_PRIVATE:
+        {
+            err = HW_SCE_Rsa2048ModularExponentDecryptSub(p_job->p_key_index, p_job->p_input, p_job->p_output);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return err;
+}
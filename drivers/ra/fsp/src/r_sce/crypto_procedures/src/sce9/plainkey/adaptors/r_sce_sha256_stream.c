@@ -0,0 +1,276 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "bsp_api.h"
+#include "hw_sce_ra_private.h"
+#include "hw_sce_hash_private.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define HW_SCE_SHA256_BLOCK_BYTES    (64U)
+#define HW_SCE_SHA256_BLOCK_WORDS    (16U)
+#define HW_SCE_SHA256_LENGTH_BYTES   (8U)
+
+#define HW_SCE_SHA256_ROTR(x, n)     (((x) >> (n)) | ((x) << (32U - (n))))
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      hw_sce_sha256_sw_blocks(uint32_t * p_state, const uint8_t * p_data, uint32_t num_blocks);
+static fsp_err_t hw_sce_sha256_blocks(hw_sce_sha256_stream_t * p_ctx, const uint8_t * p_data, uint32_t num_blocks);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static const uint32_t g_sha256_init[8] =
+{
+    0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+};
+
+static const uint32_t g_sha256_k[64] =
+{
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+/*******************************************************************************************************************//**
+ * Starts a SHA-256 hash.
+ * @param[out] p_ctx        Context
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_ASSERTION  p_ctx is NULL.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_Sha256StreamInit (hw_sce_sha256_stream_t * p_ctx)
+{
+    FSP_ERROR_RETURN(NULL != p_ctx, FSP_ERR_ASSERTION);
+
+    memcpy(p_ctx->state, g_sha256_init, sizeof(p_ctx->state));
+    p_ctx->buffered = 0U;
+    p_ctx->total    = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Adds data to a SHA-256 hash. Data of any length and alignment is accepted; whole blocks are hashed by the engine
+ * when the data is word aligned and at least HW_SCE_SHA256_STREAM_HW_MIN_BLOCKS blocks long, and in software otherwise.
+ * @param[in,out] p_ctx     Context
+ * @param[in]  p_data       Data
+ * @param[in]  size         Length of the data in bytes
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_ASSERTION  p_ctx or p_data is NULL.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_Sha256StreamUpdate (hw_sce_sha256_stream_t * p_ctx, const uint8_t * p_data, uint32_t size)
+{
+    FSP_ERROR_RETURN(NULL != p_ctx, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN((NULL != p_data) || (0U == size), FSP_ERR_ASSERTION);
+
+    fsp_err_t err    = FSP_SUCCESS;
+    uint8_t * p_buf  = (uint8_t *) p_ctx->buffer;
+    uint32_t  offset = 0U;
+
+    p_ctx->total += size;
+
+    if (0U != p_ctx->buffered)
+    {
+        uint32_t fill = HW_SCE_SHA256_BLOCK_BYTES - p_ctx->buffered;
+        if (fill > size)
+        {
+            fill = size;
+        }
+
+        memcpy(&p_buf[p_ctx->buffered], p_data, fill);
+        p_ctx->buffered += fill;
+        offset           = fill;
+
+        if (HW_SCE_SHA256_BLOCK_BYTES == p_ctx->buffered)
+        {
+            err             = hw_sce_sha256_blocks(p_ctx, p_buf, 1U);
+            p_ctx->buffered = 0U;
+        }
+    }
+
+    uint32_t num_blocks = (size - offset) / HW_SCE_SHA256_BLOCK_BYTES;
+    if ((FSP_SUCCESS == err) && (0U != num_blocks))
+    {
+        err     = hw_sce_sha256_blocks(p_ctx, &p_data[offset], num_blocks);
+        offset += num_blocks * HW_SCE_SHA256_BLOCK_BYTES;
+    }
+
+    if ((FSP_SUCCESS == err) && (offset < size))
+    {
+        memcpy(p_buf, &p_data[offset], size - offset);
+        p_ctx->buffered = size - offset;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Pads the message and outputs the digest. The context is cleared and must be initialized again before reuse.
+ * @param[in,out] p_ctx     Context
+ * @param[out] p_digest     32-byte digest
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_ASSERTION  p_ctx or p_digest is NULL.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_Sha256StreamFinish (hw_sce_sha256_stream_t * p_ctx, uint8_t * p_digest)
+{
+    FSP_ERROR_RETURN(NULL != p_ctx, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_digest, FSP_ERR_ASSERTION);
+
+    uint8_t  pad[HW_SCE_SHA256_BLOCK_BYTES * 2U] = {0};
+    uint32_t pad_len = p_ctx->buffered + 1U + HW_SCE_SHA256_LENGTH_BYTES;
+    uint64_t bits    = p_ctx->total << 3;
+
+    pad_len = (pad_len <= HW_SCE_SHA256_BLOCK_BYTES) ? HW_SCE_SHA256_BLOCK_BYTES : (HW_SCE_SHA256_BLOCK_BYTES * 2U);
+
+    memcpy(pad, p_ctx->buffer, p_ctx->buffered);
+    pad[p_ctx->buffered] = 0x80U;
+    for (uint32_t i = 0U; i < HW_SCE_SHA256_LENGTH_BYTES; i++)
+    {
+        pad[pad_len - 1U - i] = (uint8_t) (bits >> (8U * i));
+    }
+
+    /* The padding is at most two blocks, which is always cheaper in software. */
+    hw_sce_sha256_sw_blocks(p_ctx->state, pad, pad_len / HW_SCE_SHA256_BLOCK_BYTES);
+
+    for (uint32_t i = 0U; i < 8U; i++)
+    {
+        p_digest[(4U * i)]      = (uint8_t) (p_ctx->state[i] >> 24);
+        p_digest[(4U * i) + 1U] = (uint8_t) (p_ctx->state[i] >> 16);
+        p_digest[(4U * i) + 2U] = (uint8_t) (p_ctx->state[i] >> 8);
+        p_digest[(4U * i) + 3U] = (uint8_t) (p_ctx->state[i]);
+    }
+
+    memset(pad, 0, sizeof(pad));
+    memset(p_ctx, 0, sizeof(*p_ctx));
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Hashes whole blocks, on the engine when it is worth it and free, in software otherwise.
+ * @param[in,out] p_ctx     Context
+ * @param[in]  p_data       Blocks
+ * @param[in]  num_blocks   Number of blocks
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval Any Other Error Code propagated from the SCE procedure.
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_sha256_blocks (hw_sce_sha256_stream_t * p_ctx, const uint8_t * p_data, uint32_t num_blocks)
+{
+    if ((num_blocks >= HW_SCE_SHA256_STREAM_HW_MIN_BLOCKS) && (0U == ((uintptr_t) p_data & 3U)))
+    {
+        uint32_t  init_val[8];
+        uint32_t  digest[8];
+        fsp_err_t err;
+
+        /* The engine takes and returns the intermediate hash value in big-endian byte order. */
+        for (uint32_t i = 0U; i < 8U; i++)
+        {
+            init_val[i] = change_endian_long(p_ctx->state[i]);
+        }
+
+        HW_SCE_ENGINE_CALL(err,
+                           HW_SCE_Sha224256GenerateMessageDigestSub(init_val,
+                                                                    (const uint32_t *) p_data,
+                                                                    num_blocks * HW_SCE_SHA256_BLOCK_WORDS,
+                                                                    digest));
+        if (FSP_SUCCESS == err)
+        {
+            for (uint32_t i = 0U; i < 8U; i++)
+            {
+                p_ctx->state[i] = change_endian_long(digest[i]);
+            }
+
+            return FSP_SUCCESS;
+        }
+
+        /* A public-key job or another procedure owns the engine; fall back to software rather than wait for it. */
+        FSP_ERROR_RETURN((FSP_ERR_IN_USE == err) || (FSP_ERR_CRYPTO_SCE_RESOURCE_CONFLICT == err), err);
+    }
+
+    hw_sce_sha256_sw_blocks(p_ctx->state, p_data, num_blocks);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Software SHA-256 compression function.
+ * @param[in,out] p_state   Intermediate hash value
+ * @param[in]  p_data       Blocks
+ * @param[in]  num_blocks   Number of blocks
+ **********************************************************************************************************************/
+static void hw_sce_sha256_sw_blocks (uint32_t * p_state, const uint8_t * p_data, uint32_t num_blocks)
+{
+    uint32_t w[64];
+
+    for (uint32_t block = 0U; block < num_blocks; block++)
+    {
+        const uint8_t * p_block = &p_data[block * HW_SCE_SHA256_BLOCK_BYTES];
+
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            w[i] = ((uint32_t) p_block[4U * i] << 24) | ((uint32_t) p_block[(4U * i) + 1U] << 16) |
+                   ((uint32_t) p_block[(4U * i) + 2U] << 8) | (uint32_t) p_block[(4U * i) + 3U];
+        }
+
+        for (uint32_t i = 16U; i < 64U; i++)
+        {
+            uint32_t s0 = HW_SCE_SHA256_ROTR(w[i - 15U], 7U) ^ HW_SCE_SHA256_ROTR(w[i - 15U], 18U) ^
+                          (w[i - 15U] >> 3);
+            uint32_t s1 = HW_SCE_SHA256_ROTR(w[i - 2U], 17U) ^ HW_SCE_SHA256_ROTR(w[i - 2U], 19U) ^
+                          (w[i - 2U] >> 10);
+            w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+        }
+
+        uint32_t a = p_state[0];
+        uint32_t b = p_state[1];
+        uint32_t c = p_state[2];
+        uint32_t d = p_state[3];
+        uint32_t e = p_state[4];
+        uint32_t f = p_state[5];
+        uint32_t g = p_state[6];
+        uint32_t h = p_state[7];
+
+        for (uint32_t i = 0U; i < 64U; i++)
+        {
+            uint32_t s1 = HW_SCE_SHA256_ROTR(e, 6U) ^ HW_SCE_SHA256_ROTR(e, 11U) ^ HW_SCE_SHA256_ROTR(e, 25U);
+            uint32_t t1 = h + s1 + ((e & f) ^ ((~e) & g)) + g_sha256_k[i] + w[i];
+            uint32_t s0 = HW_SCE_SHA256_ROTR(a, 2U) ^ HW_SCE_SHA256_ROTR(a, 13U) ^ HW_SCE_SHA256_ROTR(a, 22U);
+            uint32_t t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        p_state[0] += a;
+        p_state[1] += b;
+        p_state[2] += c;
+        p_state[3] += d;
+        p_state[4] += e;
+        p_state[5] += f;
+        p_state[6] += g;
+        p_state[7] += h;
+    }
+
+    memset(w, 0, sizeof(w));
+}
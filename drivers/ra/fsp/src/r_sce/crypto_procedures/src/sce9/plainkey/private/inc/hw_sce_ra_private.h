@@ -899,4 +899,73 @@ fsp_err_t HW_SCE_Aes128XtsDecryptInitSubGeneral (uint32_t InData_KeyMode[],
                                                  uint32_t InData_KeyIndex[],
                                                  uint32_t InData_Key[],
                                                  uint32_t InData_IV[]);
+
+/** Public-key operations that can be queued with HW_SCE_PkaJobSubmit. */
+typedef enum e_hw_sce_pka_op
+{
+    HW_SCE_PKA_OP_ECDSA_SIGN,           ///< ECDSA signature generation, P-256 class curves
+    HW_SCE_PKA_OP_ECDSA_P384_SIGN,      ///< ECDSA signature generation, P-384 class curves
+    HW_SCE_PKA_OP_ECDSA_VERIFY,         ///< ECDSA signature verification, P-256 class curves
+    HW_SCE_PKA_OP_ECDSA_P384_VERIFY,    ///< ECDSA signature verification, P-384 class curves
+    HW_SCE_PKA_OP_ECC256_SCALAR_MULT,   ///< Scalar multiplication (ECDH), P-256 class curves
+    HW_SCE_PKA_OP_ECC384_SCALAR_MULT,   ///< Scalar multiplication (ECDH), P-384 class curves
+    HW_SCE_PKA_OP_RSA1024_PUBLIC,       ///< RSA-1024 public key operation
+    HW_SCE_PKA_OP_RSA2048_PUBLIC,       ///< RSA-2048 public key operation
+    HW_SCE_PKA_OP_RSA3072_PUBLIC,       ///< RSA-3072 public key operation
+    HW_SCE_PKA_OP_RSA4096_PUBLIC,       ///< RSA-4096 public key operation
+    HW_SCE_PKA_OP_RSA1024_PRIVATE,      ///< RSA-1024 private key operation
+    HW_SCE_PKA_OP_RSA2048_PRIVATE,      ///< RSA-2048 private key operation
+    HW_SCE_PKA_OP_NUM,
+} hw_sce_pka_op_t;
+
+/** State of a public-key job. */
+typedef enum e_hw_sce_pka_job_state
+{
+    HW_SCE_PKA_JOB_STATE_IDLE = 0,     ///< Not submitted yet or cancelled
+    HW_SCE_PKA_JOB_STATE_QUEUED,       ///< Waiting for the engine
+    HW_SCE_PKA_JOB_STATE_RUNNING,      ///< Running on the engine
+    HW_SCE_PKA_JOB_STATE_DONE,         ///< Completed, result is valid
+} hw_sce_pka_job_state_t;
+
+/** Public-key job. Zero the structure before the first submission. The arguments are the ones of the matching
+ *  HW_SCE_*SubAdaptor procedure; the members an operation does not use are ignored. */
+typedef struct st_hw_sce_pka_job
+{
+    struct st_hw_sce_pka_job * p_next;                         ///< Used by the queue
+    hw_sce_pka_op_t            op;                             ///< Operation to run
+    uint32_t const           * p_curve_type;                   ///< Curve type, ECC operations only
+    uint32_t const           * p_cmd;                          ///< Command, P-256 class ECC operations only
+    uint32_t                 * p_key_index;                    ///< Wrapped key
+    uint32_t const           * p_input;                        ///< Message digest, public point or RSA input
+    uint32_t const           * p_signature;                    ///< Signature, ECDSA verification only
+    uint32_t                 * p_output;                       ///< Signature, shared point or RSA output
+    void (* p_callback)(struct st_hw_sce_pka_job * p_job);     ///< Called from HW_SCE_PkaJobProcess when done
+    void                            * p_context;               ///< User defined context
+    volatile hw_sce_pka_job_state_t   state;                   ///< Job state
+    volatile fsp_err_t                result;                  ///< Result of the procedure once state is DONE
+} hw_sce_pka_job_t;
+
+/** Runs an SCE procedure with the engine lock held. err is set to FSP_ERR_IN_USE without calling the procedure when
+ *  a public-key job or another caller owns the engine and HW_SCE_EngineLock cannot wait for it. */
+#define HW_SCE_ENGINE_CALL(err, call)    \
+    do                                   \
+    {                                    \
+        (err) = HW_SCE_EngineLock();     \
+        if (FSP_SUCCESS == (err))        \
+        {                                \
+            (err) = (call);              \
+            HW_SCE_EngineUnlock();       \
+        }                                \
+    } while (0)
+
+void HW_SCE_EngineLockHookSet(fsp_err_t (* p_take)(void * p_context), void (* p_give)(void * p_context),
+                              void * p_context);
+fsp_err_t HW_SCE_EngineLock(void);
+void      HW_SCE_EngineUnlock(void);
+
+void      HW_SCE_PkaJobNotifySet(void (* p_notify)(void * p_context), void * p_context);
+fsp_err_t HW_SCE_PkaJobSubmit(hw_sce_pka_job_t * const p_job);
+fsp_err_t HW_SCE_PkaJobCancel(hw_sce_pka_job_t * const p_job);
+uint32_t  HW_SCE_PkaJobProcess(void);
+
 #endif /* HW_SCE_RA_PRIVATE_HEADER_FILE */
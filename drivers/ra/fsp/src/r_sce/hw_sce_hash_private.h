@@ -16,6 +16,22 @@
 #define HW_SCE_LARGE_DATA_VALUE_0    (0x80000000U)
 #define HW_SCE_LARGE_DATA_VALUE_1    (0x00000000U)
 
+/* Updates shorter than this many 64-byte blocks are hashed in software, where the engine setup costs more than it
+ * saves. */
+#ifndef HW_SCE_SHA256_STREAM_HW_MIN_BLOCKS
+ #define HW_SCE_SHA256_STREAM_HW_MIN_BLOCKS    (2U)
+#endif
+
+/** SHA-256 streaming context. The engine keeps no state between calls, so any number of contexts can be interleaved
+ *  and a context can be copied to save or fork a running hash. */
+typedef struct st_hw_sce_sha256_stream
+{
+    uint32_t state[8];                 ///< Intermediate hash value
+    uint32_t buffer[16];               ///< Partial block, word aligned for the engine
+    uint32_t buffered;                 ///< Number of bytes in buffer
+    uint64_t total;                    ///< Number of bytes hashed so far
+} hw_sce_sha256_stream_t;
+
 /*******************************************************************************************************************//**
  * Converts byte data to bit data. This function returns upper 3 digits.
  ***********************************************************************************************************************/
@@ -74,4 +90,8 @@ extern fsp_err_t HW_SCE_Sha3GenerateMessageDigestSubGeneral(const uint32_t InDat
                                                             uint32_t       OutData_State[],
                                                             const uint32_t MAX_CNT);
 
+fsp_err_t HW_SCE_Sha256StreamInit(hw_sce_sha256_stream_t * p_ctx);
+fsp_err_t HW_SCE_Sha256StreamUpdate(hw_sce_sha256_stream_t * p_ctx, const uint8_t * p_data, uint32_t size);
+fsp_err_t HW_SCE_Sha256StreamFinish(hw_sce_sha256_stream_t * p_ctx, uint8_t * p_digest);
+
 #endif                                 /* HW_SCE_HASH_PRIVATE_H */
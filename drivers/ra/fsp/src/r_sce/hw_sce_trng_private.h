@@ -15,10 +15,52 @@
 
 // TRNG
 
+/** Size of the entropy pool in bytes. Must be a multiple of 4. */
+#ifndef HW_SCE_RNG_POOL_SIZE_BYTES
+ #define HW_SCE_RNG_POOL_SIZE_BYTES    (64U)
+#endif
+
+/** Entropy pool counters */
+typedef struct st_hw_sce_rng_pool_stats
+{
+    uint32_t words_generated;          ///< Words read from the TRNG, rejected words included
+    uint32_t rct_failures;             ///< Failures of the repetition count test
+    uint32_t apt_failures;             ///< Failures of the adaptive proportion test
+    uint32_t pool_bytes;               ///< Bytes served from the pool
+    uint32_t direct_bytes;             ///< Bytes generated synchronously because the pool was drained
+    uint32_t pool_empty;               ///< Reads the pool could not fully serve
+    uint32_t pool_level;               ///< Bytes currently in the pool
+    bool     health_failed;            ///< A health test has failed and HW_SCE_RNG_HealthReset has not been called
+} hw_sce_rng_pool_stats_t;
+
 /**
  * @brief Generate 128-bit random number using SCE HW TRNG
  * @param[out] OutData_Text 128-bit random number will be stored in this buffer
  */
 fsp_err_t HW_SCE_RNG_Read(uint32_t * OutData_Text);
 
+/**
+ * @brief Read random bytes, from the entropy pool when it holds enough data
+ * @param[out] p_dest Destination buffer
+ * @param[in] size Number of bytes to read
+ */
+fsp_err_t HW_SCE_RNG_PoolRead(uint8_t * p_dest, uint32_t size);
+
+/**
+ * @brief Advance the background refill of the entropy pool without blocking
+ * @return Number of bytes the refill still has to generate, 0 when there is nothing left to do
+ */
+uint32_t HW_SCE_RNG_PoolRefill(void);
+
+/**
+ * @brief Get the entropy pool and health test counters
+ * @param[out] p_stats Counters
+ */
+fsp_err_t HW_SCE_RNG_PoolStatsGet(hw_sce_rng_pool_stats_t * p_stats);
+
+/**
+ * @brief Clear a health test failure so that random data is produced again
+ */
+void HW_SCE_RNG_HealthReset(void);
+
 #endif                                 /* HW_SCE_TRNG_PRIVATE_H */
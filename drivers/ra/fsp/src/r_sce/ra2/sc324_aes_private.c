@@ -12,6 +12,22 @@
 #include "hw_sce_private.h"
 #include "hw_sce_aes_private.h"
 
+/* Data of at least this many words is moved by the transfer instances when they are set */
+#define HW_SC324_AES_TRANSFER_MIN_WORDS     (4U * SIZE_AES_BLOCK_WORDS)
+
+/* Blocks moved by one transfer. Within the transfer_info_t::num_blocks range of both DTC and DMAC. */
+#define HW_SC324_AES_TRANSFER_MAX_BLOCKS    (0x8000U)
+
+/* Time the transfers may go without completing a block before the operation is abandoned. A block takes far less
+ * than a microsecond, so this only expires when a request is never served. */
+#define HW_SC324_AES_TRANSFER_STALL_USECONDS            (1000U)
+#define HW_SC324_AES_TRANSFER_CHECK_INTERVAL_USECONDS   (1U)
+
+static transfer_instance_t const * gp_sc324_aes_transfer_write = NULL;
+static transfer_instance_t const * gp_sc324_aes_transfer_read  = NULL;
+static transfer_info_t             g_sc324_aes_write_info;
+static transfer_info_t             g_sc324_aes_read_info;
+
 __STATIC_INLINE void hw_sc324_aes_kernel_module_enable ()
 {
     R_AES->AESMOD_b.MODEN = 1;
@@ -165,6 +181,142 @@ static void hw_sc324_aes_kernel_data_read (uint32_t * p_data)
     hw_sc324_aes_endian_convert(p_data, temp, 4);
 }
 
+/*******************************************************************************************************************//**
+ * Process data in place by letting the AES write and read requests activate the transfer instances. The data is split
+ * into transfers of at most HW_SC324_AES_TRANSFER_MAX_BLOCKS blocks. The CPU polls the read transfer until its last
+ * block has been moved.
+ *
+ * @param[in,out]  p_data          Big endian input words, replaced by the output words
+ * @param[in]      num_words       Number of words, a multiple of SIZE_AES_BLOCK_WORDS
+ *
+ * @retval FSP_SUCCESS                          All blocks were processed.
+ * @retval FSP_ERR_TIMEOUT                      No block completed for HW_SC324_AES_TRANSFER_STALL_USECONDS.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref transfer_api_t::reconfigure
+ *             * @ref transfer_api_t::infoGet
+ *             * @ref transfer_api_t::disable
+ **********************************************************************************************************************/
+static fsp_err_t hw_sc324_aes_kernel_data_transfer (uint32_t * p_data, uint32_t num_words)
+{
+    fsp_err_t             err    = FSP_SUCCESS;
+    uint32_t              offset = 0U;
+    transfer_properties_t properties;
+
+    while ((offset < num_words) && (FSP_SUCCESS == err))
+    {
+        uint32_t blocks = (num_words - offset) / SIZE_AES_BLOCK_WORDS;
+        blocks = (blocks < HW_SC324_AES_TRANSFER_MAX_BLOCKS) ? blocks : HW_SC324_AES_TRANSFER_MAX_BLOCKS;
+
+        // Each write request moves one block from memory to AESDW and each read request moves one block back to the
+        // same place. Block n is only overwritten after the engine has consumed it, so the data is processed in place.
+        g_sc324_aes_write_info.p_src      = p_data + offset;
+        g_sc324_aes_write_info.num_blocks = (uint16_t) blocks;
+        g_sc324_aes_read_info.p_dest      = p_data + offset;
+        g_sc324_aes_read_info.num_blocks  = (uint16_t) blocks;
+
+        err = gp_sc324_aes_transfer_read->p_api->reconfigure(gp_sc324_aes_transfer_read->p_ctrl,
+                                                             &g_sc324_aes_read_info);
+        if (FSP_SUCCESS == err)
+        {
+            err = gp_sc324_aes_transfer_write->p_api->reconfigure(gp_sc324_aes_transfer_write->p_ctrl,
+                                                                  &g_sc324_aes_write_info);
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            // Assert the write and read requests; no CPU access to AESDW until the last block has been read
+            R_AES->AESMOD_b.RDRQEN = 1;
+            R_AES->AESMOD_b.WRRQEN = 1;
+
+            uint32_t remaining  = blocks;
+            uint32_t wait_count = HW_SC324_AES_TRANSFER_STALL_USECONDS;
+            while ((FSP_SUCCESS == err) && (0U != remaining))
+            {
+                err = gp_sc324_aes_transfer_read->p_api->infoGet(gp_sc324_aes_transfer_read->p_ctrl, &properties);
+                if (FSP_SUCCESS != err)
+                {
+                    // Leave the loop with the error
+                }
+                else if (properties.block_count_remaining != remaining)
+                {
+                    // Progress was made, restart the stall timeout
+                    remaining  = properties.block_count_remaining;
+                    wait_count = HW_SC324_AES_TRANSFER_STALL_USECONDS;
+                }
+                else if (0U == wait_count)
+                {
+                    err = FSP_ERR_TIMEOUT;
+                }
+                else
+                {
+                    R_BSP_SoftwareDelay(HW_SC324_AES_TRANSFER_CHECK_INTERVAL_USECONDS, BSP_DELAY_UNITS_MICROSECONDS);
+                    wait_count -= HW_SC324_AES_TRANSFER_CHECK_INTERVAL_USECONDS;
+                }
+            }
+
+            R_AES->AESMOD_b.WRRQEN = 0;
+            R_AES->AESMOD_b.RDRQEN = 0;
+
+            if (FSP_SUCCESS != err)
+            {
+                // Leave no transfer armed on the AES requests
+                gp_sc324_aes_transfer_write->p_api->disable(gp_sc324_aes_transfer_write->p_ctrl);
+                gp_sc324_aes_transfer_read->p_api->disable(gp_sc324_aes_transfer_read->p_ctrl);
+            }
+        }
+
+        offset += blocks * SIZE_AES_BLOCK_WORDS;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Set the transfer instances used to move data blocks to and from the AES engine. Once set, requests of at least
+ * four blocks are transferred by the transfer instances instead of word by word by the CPU.
+ *
+ * @param[in]  p_transfer_write    Opened transfer instance activated by ELC_EVENT_AES_WRREQ, or NULL
+ * @param[in]  p_transfer_read     Opened transfer instance activated by ELC_EVENT_AES_RDREQ, or NULL
+ *
+ * @retval FSP_SUCCESS                          The transfer instances are set.
+ * @retval FSP_ERR_INVALID_ARGUMENT             Only one of the transfer instances is set.
+ **********************************************************************************************************************/
+fsp_err_t hw_sc324_aes_kernel_transfer_set (transfer_instance_t const * p_transfer_write,
+                                            transfer_instance_t const * p_transfer_read)
+{
+    if ((NULL == p_transfer_write) != (NULL == p_transfer_read))
+    {
+        return FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    // Block mode moving one 16 byte block per request; the AESDW side is fixed
+    g_sc324_aes_write_info.transfer_settings_word                  = 0U;
+    g_sc324_aes_write_info.transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    g_sc324_aes_write_info.transfer_settings_word_b.size           = TRANSFER_SIZE_4_BYTE;
+    g_sc324_aes_write_info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    g_sc324_aes_write_info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    g_sc324_aes_write_info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+    g_sc324_aes_write_info.transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    g_sc324_aes_write_info.p_dest = (void *) &R_AES->AESDW;
+    g_sc324_aes_write_info.length = SIZE_AES_BLOCK_WORDS;
+
+    g_sc324_aes_read_info.transfer_settings_word                  = 0U;
+    g_sc324_aes_read_info.transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    g_sc324_aes_read_info.transfer_settings_word_b.size           = TRANSFER_SIZE_4_BYTE;
+    g_sc324_aes_read_info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+    g_sc324_aes_read_info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    g_sc324_aes_read_info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    g_sc324_aes_read_info.transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    g_sc324_aes_read_info.p_src  = (void const *) &R_AES->AESDW;
+    g_sc324_aes_read_info.length = SIZE_AES_BLOCK_WORDS;
+
+    gp_sc324_aes_transfer_write = p_transfer_write;
+    gp_sc324_aes_transfer_read  = p_transfer_read;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Helper routine to process AES encryption and Decryption.
  *
@@ -178,6 +330,8 @@ static void hw_sc324_aes_kernel_data_read (uint32_t * p_data)
  *
  * @retval FSP_SUCCESS                          The operation completed successfully.
  * @retval FSP_ERR_CRYPTO_INVALID_SIZE          The size of the data must be multiples of 4 WORDS / 16 bytes.
+ * @retval FSP_ERR_NOT_ENABLED                  The transfer instances could not be enabled. OutData_Text is cleared.
+ * @retval FSP_ERR_TIMEOUT                      The transfer instances stopped moving data. OutData_Text is cleared.
  *
  **********************************************************************************************************************/
 fsp_err_t hw_sc324_aes_kernel_process_data (hw_sc324_aes_ctrl_t * p_ctrl,
@@ -216,7 +370,28 @@ fsp_err_t hw_sc324_aes_kernel_process_data (hw_sc324_aes_ctrl_t * p_ctrl,
     // When writing to the AESCMD, check if the AESCMD.com_write_ready is 1
     hw_sc324_aes_kernel_inverse_cipher_set(p_ctrl->encrypt_flag);
 
-    for (uint32_t indx = 0; indx < num_words; indx += SIZE_AES_BLOCK_WORDS)
+    fsp_err_t err       = FSP_SUCCESS;
+    uint32_t  cpu_words = num_words;
+    if ((NULL != gp_sc324_aes_transfer_write) && (HW_SC324_AES_TRANSFER_MIN_WORDS <= num_words))
+    {
+        // 5-7. Let the write and read requests move the data. The engine takes big endian words, so convert into the
+        // output buffer first and back after the last block.
+        hw_sc324_aes_endian_convert(OutData_Text, InData_Text, num_words);
+        err = hw_sc324_aes_kernel_data_transfer(OutData_Text, num_words);
+        if (FSP_SUCCESS == err)
+        {
+            hw_sc324_aes_endian_convert(OutData_Text, OutData_Text, num_words);
+        }
+        else
+        {
+            // Do not leave partly processed data in the output
+            memset(OutData_Text, 0, num_words * sizeof(uint32_t));
+        }
+
+        cpu_words = 0U;
+    }
+
+    for (uint32_t indx = 0; indx < cpu_words; indx += SIZE_AES_BLOCK_WORDS)
     {
         // 5. Write data to data-register (one block (128 bits) of data).
         // When writing to data-register, write 1 word (32 bits) to AESDW after confirmation of write_ready=1
@@ -238,7 +413,7 @@ fsp_err_t hw_sc324_aes_kernel_process_data (hw_sc324_aes_ctrl_t * p_ctrl,
         continue;
     }
 
-    if (OutData_IV)
+    if (OutData_IV && (FSP_SUCCESS == err))
     {
         hw_sc324_aes_kernel_iv_get(OutData_IV);
     }
@@ -246,5 +421,10 @@ fsp_err_t hw_sc324_aes_kernel_process_data (hw_sc324_aes_ctrl_t * p_ctrl,
     // 8. When ending use of a AES module, please write 0 to mode-register.module_en
     hw_sc324_aes_kernel_module_disable();
 
-    return FSP_SUCCESS;
+    if (FSP_ERR_TIMEOUT == err)
+    {
+        return FSP_ERR_TIMEOUT;
+    }
+
+    return (FSP_SUCCESS == err) ? FSP_SUCCESS : FSP_ERR_NOT_ENABLED;
 }
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include "bsp_api.h"
+#include "r_transfer_api.h"
 
 typedef enum e_hw_sc324_aes_modes
 {
@@ -49,5 +50,7 @@ fsp_err_t hw_sc324_aes_kernel_process_data(hw_sc324_aes_ctrl_t * p_ctrl,
                                            const uint32_t      * InData_Text,
                                            uint32_t            * OutData_Text,
                                            uint32_t            * OutData_IV);
+fsp_err_t hw_sc324_aes_kernel_transfer_set(transfer_instance_t const * p_transfer_write,
+                                           transfer_instance_t const * p_transfer_read);
 
 #endif                                 /* SC324_AES_PRIVATE_H */
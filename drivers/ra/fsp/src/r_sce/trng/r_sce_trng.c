@@ -8,34 +8,381 @@
  * Includes
  **********************************************************************************************************************/
 
+#include <string.h>
 #include "bsp_api.h"
 #include "hw_sce_trng_private.h"
 
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Number of bytes read from TRNGSDR for each seed generation. */
+#define HW_SCE_RNG_SEED_BYTES      (4U)
+
+#if (0U != (HW_SCE_RNG_POOL_SIZE_BYTES % HW_SCE_RNG_SEED_BYTES)) || (0U == HW_SCE_RNG_POOL_SIZE_BYTES)
+ #error "HW_SCE_RNG_POOL_SIZE_BYTES must be a non-zero multiple of 4."
+#endif
+
+/* Health tests of NIST SP 800-90B section 4.4, run on each byte of TRNG output. The default cutoffs assume a
+ * min-entropy of 1 bit per byte and give a false positive probability of 2^-20 per test. */
+
+/* Repetition count test: number of identical consecutive bytes that is a failure, 1 + ceil(20 / H). */
+#ifndef HW_SCE_RNG_RCT_CUTOFF
+ #define HW_SCE_RNG_RCT_CUTOFF     (21U)
+#endif
+
+/* Adaptive proportion test: window size, and number of bytes in a window equal to its first byte that is a failure. */
+#define HW_SCE_RNG_APT_WINDOW      (512U)
+#ifndef HW_SCE_RNG_APT_CUTOFF
+ #define HW_SCE_RNG_APT_CUTOFF     (410U)
+#endif
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      hw_sce_rng_seed_start(void);
+static uint32_t  hw_sce_rng_seed_read(void);
+static bool      hw_sce_rng_health_check(uint32_t word);
+static void      hw_sce_rng_health_fail(void);
+static fsp_err_t hw_sce_rng_word_generate(uint32_t * p_word);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* Entropy pool, used as a ring buffer. */
+static uint8_t  g_rng_pool[HW_SCE_RNG_POOL_SIZE_BYTES];
+static uint32_t g_rng_pool_out   = 0U; // Index of the next byte to hand out
+static uint32_t g_rng_pool_count = 0U; // Number of bytes available
+
+/* Set while the refill has started a seed generation that has not been read yet. */
+static bool g_rng_refill_pending = false;
+
+/* Number of callers currently generating synchronously. The refill leaves the TRNG alone while it is not zero. */
+static uint32_t g_rng_sync_users = 0U;
+
+/* Repetition count test state */
+static uint8_t  g_rng_rct_value = 0U;
+static uint32_t g_rng_rct_count = 0U; // Zero until the first byte has been tested
+
+/* Adaptive proportion test state */
+static uint8_t  g_rng_apt_value    = 0U;
+static uint32_t g_rng_apt_count    = 0U;
+static uint32_t g_rng_apt_position = 0U; // Bytes tested in the current window, zero before the window starts
+
+/* Set when a health test fails. No random data is produced until HW_SCE_RNG_HealthReset is called. */
+static bool g_rng_health_failed = false;
+
+static hw_sce_rng_pool_stats_t g_rng_stats;
+
 /*******************************************************************************************************************//**
  * 128bit Random Number Generation
  * @param      OutData_Text    The out data text
  * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_CRYPTO_SCE_FAIL  A TRNG health test has failed.
  **********************************************************************************************************************/
 fsp_err_t HW_SCE_RNG_Read (uint32_t * OutData_Text) {
-    uint8_t * ptmp = (uint8_t *) OutData_Text;
-    uint32_t  k;
-    for (k = 0; k < 4; k++)            // read 4 words of random data similar (to make this API consistent with S7 and S3 implementation)
+    // read 4 words of random data similar (to make this API consistent with S7 and S3 implementation)
+    return HW_SCE_RNG_PoolRead((uint8_t *) OutData_Text, 4U * sizeof(uint32_t));
+}
+
+/*******************************************************************************************************************//**
+ * Reads random bytes. Bytes are taken from the entropy pool first; the TRNG is only run synchronously for the part of
+ * the request the pool cannot serve.
+ * @param[out] p_dest       Destination buffer
+ * @param[in]  size         Number of bytes to read
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_ASSERTION  p_dest is NULL.
+ * @retval FSP_ERR_CRYPTO_SCE_FAIL  A TRNG health test has failed. p_dest may have been partly written.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_RNG_PoolRead (uint8_t * p_dest, uint32_t size)
+{
+    FSP_ERROR_RETURN((NULL != p_dest) || (0U == size), FSP_ERR_ASSERTION);
+
+    uint32_t copied = 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (g_rng_health_failed)
     {
-        /* Set SGCEN bit and SGSTART bit */
-        R_TRNG->TRNGSCR0_b.SGCEN   = 1;
-        R_TRNG->TRNGSCR0_b.SGSTART = 1;
+        FSP_CRITICAL_SECTION_EXIT;
 
-        /* Wait for RDRDY bit to be set */
-        while (0 == R_TRNG->TRNGSCR0_b.RDRDY)
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    uint32_t from_pool = (size < g_rng_pool_count) ? size : g_rng_pool_count;
+    while (copied < from_pool)
+    {
+        uint32_t chunk = HW_SCE_RNG_POOL_SIZE_BYTES - g_rng_pool_out;
+        if (chunk > (from_pool - copied))
         {
+            chunk = from_pool - copied;
         }
 
-        /* Read generated random data */
-        *ptmp++ = R_TRNG->TRNGSDR;
-        *ptmp++ = R_TRNG->TRNGSDR;
-        *ptmp++ = R_TRNG->TRNGSDR;
-        *ptmp++ = R_TRNG->TRNGSDR;
+        memcpy(&p_dest[copied], &g_rng_pool[g_rng_pool_out], chunk);
+
+        /* Bytes handed out must never be handed out again. */
+        memset(&g_rng_pool[g_rng_pool_out], 0, chunk);
+
+        g_rng_pool_out = (g_rng_pool_out + chunk) % HW_SCE_RNG_POOL_SIZE_BYTES;
+        copied        += chunk;
+    }
+
+    g_rng_pool_count       -= from_pool;
+    g_rng_stats.pool_bytes += from_pool;
+    if (copied < size)
+    {
+        g_rng_stats.pool_empty++;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    while (copied < size)
+    {
+        uint32_t  word;
+        fsp_err_t err = hw_sce_rng_word_generate(&word);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        uint32_t chunk = ((size - copied) < HW_SCE_RNG_SEED_BYTES) ? (size - copied) : HW_SCE_RNG_SEED_BYTES;
+        memcpy(&p_dest[copied], &word, chunk);
+        copied += chunk;
+
+        FSP_CRITICAL_SECTION_ENTER;
+        g_rng_stats.direct_bytes += chunk;
+        FSP_CRITICAL_SECTION_EXIT;
     }
 
     return FSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Advances the refill of the entropy pool by one step without waiting for the TRNG. Call it from the idle thread,
+ * a periodic timer or the TRNG_RDREQ interrupt until it returns 0. A word that fails a health test is discarded, the
+ * pool is emptied and the refill stops until HW_SCE_RNG_HealthReset is called.
+ * @return Number of bytes the refill still has to generate, 0 once the pool has no room for another word or after a
+ *         health test failure.
+ **********************************************************************************************************************/
+uint32_t HW_SCE_RNG_PoolRefill (void)
+{
+    uint32_t missing;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((0U == g_rng_sync_users) && !g_rng_health_failed)
+    {
+        if (g_rng_refill_pending)
+        {
+            if (0 != R_TRNG->TRNGSCR0_b.RDRDY)
+            {
+                uint32_t word = hw_sce_rng_seed_read();
+                g_rng_refill_pending = false;
+
+                if (hw_sce_rng_health_check(word))
+                {
+                    uint32_t in = (g_rng_pool_out + g_rng_pool_count) % HW_SCE_RNG_POOL_SIZE_BYTES;
+                    memcpy(&g_rng_pool[in], &word, HW_SCE_RNG_SEED_BYTES);
+                    g_rng_pool_count += HW_SCE_RNG_SEED_BYTES;
+                }
+            }
+        }
+        else if ((g_rng_pool_count + HW_SCE_RNG_SEED_BYTES) <= HW_SCE_RNG_POOL_SIZE_BYTES)
+        {
+            hw_sce_rng_seed_start();
+            g_rng_refill_pending = true;
+        }
+        else
+        {
+            /* Pool has no room for another word. */
+        }
+    }
+
+    /* Reads leave the pool level at any byte count, but the refill adds whole words. */
+    missing = HW_SCE_RNG_POOL_SIZE_BYTES - g_rng_pool_count;
+    missing = g_rng_health_failed ? 0U : (missing - (missing % HW_SCE_RNG_SEED_BYTES));
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return missing;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the entropy pool counters.
+ * @param[out] p_stats      Counters
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_ASSERTION  p_stats is NULL.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_RNG_PoolStatsGet (hw_sce_rng_pool_stats_t * p_stats)
+{
+    FSP_ERROR_RETURN(NULL != p_stats, FSP_ERR_ASSERTION);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats               = g_rng_stats;
+    p_stats->pool_level    = g_rng_pool_count;
+    p_stats->health_failed = g_rng_health_failed;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Clears a health test failure and restarts both tests on fresh TRNG output. The failure counters are kept.
+ **********************************************************************************************************************/
+void HW_SCE_RNG_HealthReset (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_rng_rct_count     = 0U;
+    g_rng_apt_position  = 0U;
+    g_rng_health_failed = false;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Starts one seed generation.
+ **********************************************************************************************************************/
+static void hw_sce_rng_seed_start (void)
+{
+    /* Set SGCEN bit and SGSTART bit */
+    R_TRNG->TRNGSCR0_b.SGCEN   = 1;
+    R_TRNG->TRNGSCR0_b.SGSTART = 1;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the result of a completed seed generation.
+ * @return Generated word, in the byte order the TRNG delivers it.
+ **********************************************************************************************************************/
+static uint32_t hw_sce_rng_seed_read (void)
+{
+    uint32_t  word;
+    uint8_t * ptmp = (uint8_t *) &word;
+
+    /* Read generated random data */
+    *ptmp++ = R_TRNG->TRNGSDR;
+    *ptmp++ = R_TRNG->TRNGSDR;
+    *ptmp++ = R_TRNG->TRNGSDR;
+    *ptmp++ = R_TRNG->TRNGSDR;
+
+    g_rng_stats.words_generated++;
+
+    return word;
+}
+
+/*******************************************************************************************************************//**
+ * Runs the repetition count and adaptive proportion tests on the bytes of a word. Must be called with interrupts
+ * disabled.
+ * @param[in]  word         Generated word
+ * @retval true             The word passed.
+ * @retval false            A test failed, or had already failed. The word must be discarded.
+ **********************************************************************************************************************/
+static bool hw_sce_rng_health_check (uint32_t word)
+{
+    uint8_t const * p_byte = (uint8_t const *) &word;
+
+    for (uint32_t i = 0U; (i < HW_SCE_RNG_SEED_BYTES) && !g_rng_health_failed; i++)
+    {
+        uint8_t sample = p_byte[i];
+
+        if ((0U != g_rng_rct_count) && (sample == g_rng_rct_value))
+        {
+            g_rng_rct_count++;
+            if (g_rng_rct_count >= HW_SCE_RNG_RCT_CUTOFF)
+            {
+                g_rng_stats.rct_failures++;
+                hw_sce_rng_health_fail();
+            }
+        }
+        else
+        {
+            g_rng_rct_value = sample;
+            g_rng_rct_count = 1U;
+        }
+
+        if (0U == g_rng_apt_position)
+        {
+            g_rng_apt_value    = sample;
+            g_rng_apt_count    = 1U;
+            g_rng_apt_position = 1U;
+        }
+        else
+        {
+            if (sample == g_rng_apt_value)
+            {
+                g_rng_apt_count++;
+                if (g_rng_apt_count >= HW_SCE_RNG_APT_CUTOFF)
+                {
+                    g_rng_stats.apt_failures++;
+                    hw_sce_rng_health_fail();
+                }
+            }
+
+            g_rng_apt_position = (g_rng_apt_position + 1U) % HW_SCE_RNG_APT_WINDOW;
+        }
+    }
+
+    return !g_rng_health_failed;
+}
+
+/*******************************************************************************************************************//**
+ * Latches a health test failure and discards the pool, which may hold output of the failing noise source. Must be
+ * called with interrupts disabled.
+ **********************************************************************************************************************/
+static void hw_sce_rng_health_fail (void)
+{
+    g_rng_health_failed = true;
+
+    memset(g_rng_pool, 0, sizeof(g_rng_pool));
+    g_rng_pool_out   = 0U;
+    g_rng_pool_count = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Generates one word, waiting for the TRNG. A seed generation already started by the refill is reused.
+ * @param[out] p_word       Generated word
+ * @retval FSP_SUCCESS      The operation completed successfully.
+ * @retval FSP_ERR_CRYPTO_SCE_FAIL  A TRNG health test has failed.
+ **********************************************************************************************************************/
+static fsp_err_t hw_sce_rng_word_generate (uint32_t * p_word)
+{
+    fsp_err_t err = FSP_ERR_CRYPTO_SCE_FAIL;
+    bool      started;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (g_rng_health_failed)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    g_rng_sync_users++;
+    started              = g_rng_refill_pending;
+    g_rng_refill_pending = false;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (!started)
+    {
+        hw_sce_rng_seed_start();
+    }
+
+    /* Wait for RDRDY bit to be set */
+    while (0 == R_TRNG->TRNGSCR0_b.RDRDY)
+    {
+    }
+
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t word = hw_sce_rng_seed_read();
+    if (hw_sce_rng_health_check(word))
+    {
+        *p_word = word;
+        err     = FSP_SUCCESS;
+    }
+
+    g_rng_sync_users--;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
@@ -21,6 +21,14 @@
  #define SCI_UART_CFG_TX_ENABLE                 1
 #endif
 
+/* Number of results kept by R_SCI_UART_BaudCalculate. Set to 0 to always run the full divisor search. */
+#ifndef SCI_UART_CFG_BAUD_TABLE_SIZE
+ #define SCI_UART_CFG_BAUD_TABLE_SIZE           (8U)
+#endif
+
+/* Number of table slots probed for a baud rate, starting at the slot its arguments hash to. */
+#define SCI_UART_BAUD_TABLE_WAYS                (2U)
+
 /* Number of divisors in the data table used for baud rate calculation. */
 #define SCI_UART_NUM_DIVISORS_ASYNC             (13U)
 
@@ -137,6 +145,20 @@ typedef struct st_baud_setting_const_t
     uint8_t cks   : 2;                 /**< CKS  value to get divisor (CKS = N) */
 } baud_setting_const_t;
 
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+
+/* Baud rate lookup table entry. A result is only reused if every input to the divisor search matches. */
+typedef struct st_sci_uart_baud_table_entry
+{
+    uint32_t       baudrate;               /**< Requested baud rate, 0 if the entry is unused */
+    uint32_t       freq_hz;                /**< SCI clock frequency the setting was calculated for */
+    uint32_t       baud_rate_error_x_1000; /**< Requested max error */
+    bool           bitrate_modulation;     /**< Bit rate modulation requested */
+    bool           pinned;                 /**< Stored by R_SCI_UART_BaudTablePrecompute, never replaced */
+    baud_setting_t baud_setting;           /**< Calculated register settings */
+} sci_uart_baud_table_entry_t;
+#endif
+
 /* Noise filter setting definition */
 typedef enum e_noise_cancel_lvl
 {
@@ -189,6 +211,30 @@ static void r_sci_uart_transfer_close(sci_uart_instance_ctrl_t * p_ctrl);
 #endif
 
 static void r_sci_uart_baud_set(R_SCI0_Type * p_sci_reg, baud_setting_t const * const p_baud_setting);
+static fsp_err_t r_sci_uart_baud_search(uint32_t               baudrate,
+                                        uint32_t               freq_hz,
+                                        bool                   bitrate_modulation,
+                                        uint32_t               baud_rate_error_x_1000,
+                                        baud_setting_t * const p_baud_setting);
+
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+static bool r_sci_uart_baud_table_lookup(uint32_t               baudrate,
+                                         uint32_t               freq_hz,
+                                         bool                   bitrate_modulation,
+                                         uint32_t               baud_rate_error_x_1000,
+                                         baud_setting_t * const p_baud_setting);
+static bool r_sci_uart_baud_table_store(uint32_t                     baudrate,
+                                        uint32_t                     freq_hz,
+                                        bool                         bitrate_modulation,
+                                        uint32_t                     baud_rate_error_x_1000,
+                                        baud_setting_t const * const p_baud_setting,
+                                        bool                         pinned);
+static uint32_t r_sci_uart_baud_table_index(uint32_t baudrate,
+                                            uint32_t freq_hz,
+                                            bool     bitrate_modulation,
+                                            uint32_t baud_rate_error_x_1000);
+
+#endif
 static void r_sci_uart_call_callback(sci_uart_instance_ctrl_t * p_ctrl, uint32_t data, uart_event_t event);
 
 #if SCI_UART_CFG_FIFO_SUPPORT
@@ -261,6 +307,13 @@ static const uint16_t g_div_coefficient[SCI_UART_NUM_DIVISORS_ASYNC] =
     2048U,
 };
 
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+
+/* Results of previous baud rate calculations, shared by all channels. A setting is stored in one of the
+ * SCI_UART_BAUD_TABLE_WAYS slots following the slot its arguments hash to, so a lookup reads at most that many slots. */
+static sci_uart_baud_table_entry_t g_sci_uart_baud_table[SCI_UART_CFG_BAUD_TABLE_SIZE];
+#endif
+
 /* UART on SCI HAL API mapping for UART interface */
 const uart_api_t g_uart_on_sci =
 {
@@ -1017,6 +1070,153 @@ fsp_err_t R_SCI_UART_BaudCalculate (uint32_t               baudrate,
     FSP_ERROR_RETURN((0U != baudrate), FSP_ERR_INVALID_ARGUMENT);
 #endif
 
+    uint32_t freq_hz = R_FSP_SystemClockHzGet(BSP_FEATURE_SCI_CLOCK);
+
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+    if (r_sci_uart_baud_table_lookup(baudrate, freq_hz, bitrate_modulation, baud_rate_error_x_1000, p_baud_setting))
+    {
+        return FSP_SUCCESS;
+    }
+#endif
+
+    fsp_err_t err = r_sci_uart_baud_search(baudrate, freq_hz, bitrate_modulation, baud_rate_error_x_1000,
+                                           p_baud_setting);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+    (void) r_sci_uart_baud_table_store(baudrate, freq_hz, bitrate_modulation, baud_rate_error_x_1000, p_baud_setting,
+                                       false);
+#endif
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Precalculates baud rate register settings for a list of baud rates so that later calls to
+ * R_SCI_UART_BaudCalculate() with the same arguments return without running the divisor search. Precalculated
+ * settings are never replaced by settings R_SCI_UART_BaudCalculate() stores at run time. Each call replaces the
+ * settings precalculated by the previous call. Settings depend on the SCI clock frequency, so this function must be
+ * called again after the SCI clock is changed.
+ *
+ * @param[in]  p_baudrates               List of baud rates [bps] to calculate settings for.
+ * @param[in]  num_baudrates             Number of entries in p_baudrates.
+ * @param[in]  bitrate_modulation        Enable bitrate modulation
+ * @param[in]  baud_rate_error_x_1000    Max baud rate error. See R_SCI_UART_BaudCalculate().
+ *
+ * @retval     FSP_SUCCESS               Settings were calculated and stored for all baud rates.
+ * @retval     FSP_ERR_ASSERTION         Null pointer
+ * @retval     FSP_ERR_INVALID_ARGUMENT  A baud rate is '0', could not be achieved within the requested error, or the
+ *                                       requested max error is larger than 15%. Settings for the preceding baud rates
+ *                                       are retained.
+ * @retval     FSP_ERR_OVERFLOW          The slots a baud rate maps to are already used by other precalculated rates.
+ *                                       Increase SCI_UART_CFG_BAUD_TABLE_SIZE. Settings for the preceding baud rates
+ *                                       are retained.
+ * @retval     FSP_ERR_UNSUPPORTED       SCI_UART_CFG_BAUD_TABLE_SIZE is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_BaudTablePrecompute (uint32_t const * const p_baudrates,
+                                          uint32_t               num_baudrates,
+                                          bool                   bitrate_modulation,
+                                          uint32_t               baud_rate_error_x_1000)
+{
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_baudrates);
+    FSP_ERROR_RETURN(SCI_UART_MAX_BAUD_RATE_ERROR_X_1000 >= baud_rate_error_x_1000, FSP_ERR_INVALID_ARGUMENT);
+ #endif
+
+    /* The search only writes the SEMR fields it selects, so clear the reserved bits before the setting is stored. */
+    baud_setting_t baud_setting = {0};
+    uint32_t       freq_hz      = R_FSP_SystemClockHzGet(BSP_FEATURE_SCI_CLOCK);
+
+    /* Release the settings precalculated by the previous call. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = 0U; i < SCI_UART_CFG_BAUD_TABLE_SIZE; i++)
+    {
+        g_sci_uart_baud_table[i].pinned = false;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    for (uint32_t i = 0U; i < num_baudrates; i++)
+    {
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+        FSP_ERROR_RETURN((0U != p_baudrates[i]), FSP_ERR_INVALID_ARGUMENT);
+ #endif
+
+        fsp_err_t err = r_sci_uart_baud_search(p_baudrates[i],
+                                               freq_hz,
+                                               bitrate_modulation,
+                                               baud_rate_error_x_1000,
+                                               &baud_setting);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        FSP_ERROR_RETURN(r_sci_uart_baud_table_store(p_baudrates[i], freq_hz, bitrate_modulation,
+                                                     baud_rate_error_x_1000, &baud_setting, true),
+                         FSP_ERR_OVERFLOW);
+    }
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_baudrates);
+    FSP_PARAMETER_NOT_USED(num_baudrates);
+    FSP_PARAMETER_NOT_USED(bitrate_modulation);
+    FSP_PARAMETER_NOT_USED(baud_rate_error_x_1000);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Suspend Reception
+ *
+ * @retval     FSP_ERR_UNSUPPORTED       Functionality not supported by this driver instance
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_ReceiveSuspend (uart_ctrl_t * const p_api_ctrl)
+{
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * Resume Reception
+ *
+ * @retval     FSP_ERR_UNSUPPORTED       Functionality not supported by this driver instance
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_ReceiveResume (uart_ctrl_t * const p_api_ctrl)
+{
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SCI_UART)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Searches all divisor, BRR and MDDR combinations for the setting with the lowest bit rate error.
+ *
+ * @param[in]  baudrate                  Baud rate [bps]
+ * @param[in]  freq_hz                   SCI clock frequency [Hz]
+ * @param[in]  bitrate_modulation        Enable bitrate modulation
+ * @param[in]  baud_rate_error_x_1000    Max baud rate error
+ * @param[out] p_baud_setting            Baud setting information stored here if successful
+ *
+ * @retval     FSP_SUCCESS               Setting found within the requested error
+ * @retval     FSP_ERR_INVALID_ARGUMENT  Error in calculated baud rate is larger than requested max error
+ **********************************************************************************************************************/
+static fsp_err_t r_sci_uart_baud_search (uint32_t               baudrate,
+                                         uint32_t               freq_hz,
+                                         bool                   bitrate_modulation,
+                                         uint32_t               baud_rate_error_x_1000,
+                                         baud_setting_t * const p_baud_setting)
+{
     p_baud_setting->brr = SCI_UART_BRR_MAX;
     p_baud_setting->semr_baudrate_bits_b.brme = 0U;
     p_baud_setting->mddr = SCI_UART_MDDR_MIN;
@@ -1031,8 +1231,6 @@ fsp_err_t R_SCI_UART_BaudCalculate (uint32_t               baudrate,
     uint8_t  hit_mddr    = 0U;
     uint32_t divisor     = 0U;
 
-    uint32_t freq_hz = R_FSP_SystemClockHzGet(BSP_FEATURE_SCI_CLOCK);
-
     for (uint32_t select_16_base_clk_cycles = 0U;
          select_16_base_clk_cycles <= 1U && (hit_bit_err > ((int32_t) baud_rate_error_x_1000));
          select_16_base_clk_cycles++)
@@ -1144,37 +1342,145 @@ fsp_err_t R_SCI_UART_BaudCalculate (uint32_t               baudrate,
     return FSP_SUCCESS;
 }
 
+#if SCI_UART_CFG_BAUD_TABLE_SIZE
+
 /*******************************************************************************************************************//**
- * Suspend Reception
+ * Looks up a previously calculated baud rate setting.
  *
- * @retval     FSP_ERR_UNSUPPORTED       Functionality not supported by this driver instance
+ * @param[in]  baudrate                  Baud rate [bps]
+ * @param[in]  freq_hz                   SCI clock frequency [Hz]
+ * @param[in]  bitrate_modulation        Enable bitrate modulation
+ * @param[in]  baud_rate_error_x_1000    Max baud rate error
+ * @param[out] p_baud_setting            Baud setting information stored here if found
+ *
+ * @retval     true                      A setting calculated from the same arguments was found
+ * @retval     false                     No matching setting was found
  **********************************************************************************************************************/
-fsp_err_t R_SCI_UART_ReceiveSuspend (uart_ctrl_t * const p_api_ctrl)
+static bool r_sci_uart_baud_table_lookup (uint32_t               baudrate,
+                                          uint32_t               freq_hz,
+                                          bool                   bitrate_modulation,
+                                          uint32_t               baud_rate_error_x_1000,
+                                          baud_setting_t * const p_baud_setting)
 {
-    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    bool     found = false;
+    uint32_t index = r_sci_uart_baud_table_index(baudrate, freq_hz, bitrate_modulation, baud_rate_error_x_1000);
 
-    return FSP_ERR_UNSUPPORTED;
+    /* The table is shared by all channels, so entries must not be read while another context updates them. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t way = 0U; way < SCI_UART_BAUD_TABLE_WAYS; way++)
+    {
+        sci_uart_baud_table_entry_t const * p_entry =
+            &g_sci_uart_baud_table[(index + way) % SCI_UART_CFG_BAUD_TABLE_SIZE];
+
+        if ((p_entry->baudrate == baudrate) && (p_entry->freq_hz == freq_hz) &&
+            (p_entry->bitrate_modulation == bitrate_modulation) &&
+            (p_entry->baud_rate_error_x_1000 == baud_rate_error_x_1000))
+        {
+            *p_baud_setting = p_entry->baud_setting;
+            found           = true;
+            break;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return found;
 }
 
 /*******************************************************************************************************************//**
- * Resume Reception
+ * Stores a calculated baud rate setting in one of the slots its arguments map to. A slot already holding the same
+ * arguments is reused, then an empty slot, then a slot that is not pinned. Pinned slots are never replaced.
  *
- * @retval     FSP_ERR_UNSUPPORTED       Functionality not supported by this driver instance
+ * @param[in]  baudrate                  Baud rate [bps]
+ * @param[in]  freq_hz                   SCI clock frequency [Hz]
+ * @param[in]  bitrate_modulation        Enable bitrate modulation
+ * @param[in]  baud_rate_error_x_1000    Max baud rate error
+ * @param[in]  p_baud_setting            Calculated baud setting
+ * @param[in]  pinned                    Keep the setting until the next call to R_SCI_UART_BaudTablePrecompute()
+ *
+ * @retval     true                      The setting was stored
+ * @retval     false                     All slots the arguments map to are pinned by other settings
  **********************************************************************************************************************/
-fsp_err_t R_SCI_UART_ReceiveResume (uart_ctrl_t * const p_api_ctrl)
+static bool r_sci_uart_baud_table_store (uint32_t                     baudrate,
+                                         uint32_t                     freq_hz,
+                                         bool                         bitrate_modulation,
+                                         uint32_t                     baud_rate_error_x_1000,
+                                         baud_setting_t const * const p_baud_setting,
+                                         bool                         pinned)
 {
-    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    sci_uart_baud_table_entry_t * p_entry = NULL;
+    uint32_t index = r_sci_uart_baud_table_index(baudrate, freq_hz, bitrate_modulation, baud_rate_error_x_1000);
 
-    return FSP_ERR_UNSUPPORTED;
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t way = 0U; way < SCI_UART_BAUD_TABLE_WAYS; way++)
+    {
+        sci_uart_baud_table_entry_t * p_slot = &g_sci_uart_baud_table[(index + way) % SCI_UART_CFG_BAUD_TABLE_SIZE];
+
+        if ((p_slot->baudrate == baudrate) && (p_slot->freq_hz == freq_hz) &&
+            (p_slot->bitrate_modulation == bitrate_modulation) &&
+            (p_slot->baud_rate_error_x_1000 == baud_rate_error_x_1000))
+        {
+            /* Same arguments: keep the slot, and keep it pinned if it already is. */
+            p_entry = p_slot;
+            pinned  = pinned || p_slot->pinned;
+            break;
+        }
+
+        if ((0U == p_slot->baudrate) && ((NULL == p_entry) || (0U != p_entry->baudrate)))
+        {
+            p_entry = p_slot;
+        }
+        else if ((NULL == p_entry) && !p_slot->pinned)
+        {
+            p_entry = p_slot;
+        }
+        else
+        {
+            /* Keep the slot already chosen. */
+        }
+    }
+
+    if (NULL != p_entry)
+    {
+        p_entry->baudrate               = baudrate;
+        p_entry->freq_hz                = freq_hz;
+        p_entry->bitrate_modulation     = bitrate_modulation;
+        p_entry->baud_rate_error_x_1000 = baud_rate_error_x_1000;
+        p_entry->pinned                 = pinned;
+        p_entry->baud_setting           = *p_baud_setting;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return NULL != p_entry;
 }
 
 /*******************************************************************************************************************//**
- * @} (end addtogroup SCI_UART)
+ * Calculates the first table slot for a set of baud rate calculation arguments.
+ *
+ * @param[in]  baudrate                  Baud rate [bps]
+ * @param[in]  freq_hz                   SCI clock frequency [Hz]
+ * @param[in]  bitrate_modulation        Enable bitrate modulation
+ * @param[in]  baud_rate_error_x_1000    Max baud rate error
+ *
+ * @return     Index of the first slot the arguments map to.
  **********************************************************************************************************************/
+static uint32_t r_sci_uart_baud_table_index (uint32_t baudrate,
+                                             uint32_t freq_hz,
+                                             bool     bitrate_modulation,
+                                             uint32_t baud_rate_error_x_1000)
+{
+    /* Multiplicative (Fibonacci) hash; the upper bits are the best mixed. */
+    uint32_t key = baudrate ^ (freq_hz >> 3) ^ (baud_rate_error_x_1000 << 20) ^ (bitrate_modulation ? 1U : 0U);
 
-/***********************************************************************************************************************
- * Private Functions
- **********************************************************************************************************************/
+    return ((key * 0x9E3779B1U) >> 16) % SCI_UART_CFG_BAUD_TABLE_SIZE;
+}
+
+#endif
 
 /*******************************************************************************************************************//**
  * Negate the DE pin if it is enabled.
@@ -63,6 +63,17 @@ static fsp_err_t r_spi_b_write_read_common(spi_ctrl_t * const    p_api_ctrl,
                                            void                * p_dest,
                                            uint32_t const        length,
                                            spi_bit_width_t const bit_width);
+static fsp_err_t r_spi_b_transfer_setup(spi_b_instance_ctrl_t * const p_ctrl,
+                                        void const                  * p_src,
+                                        void                        * p_dest,
+                                        uint32_t const                length,
+                                        spi_bit_width_t const         bit_width);
+static void      r_spi_b_ssl_select(spi_b_instance_ctrl_t * const p_ctrl, spi_b_ssl_select_t ssl_select);
+
+#if SPI_B_CFG_PARAM_CHECKING_ENABLE && SPI_B_CFG_DMA_SUPPORT_ENABLE
+static fsp_err_t r_spi_b_transfer_length_check(spi_b_instance_ctrl_t * const p_ctrl, uint32_t const length);
+
+#endif
 
 static void r_spi_b_receive(spi_b_instance_ctrl_t * p_ctrl);
 static void r_spi_b_transmit(spi_b_instance_ctrl_t * p_ctrl);
@@ -168,6 +179,10 @@ fsp_err_t R_SPI_B_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg)
 
     p_ctrl->p_regs = SPI_B_REG(p_ctrl->p_cfg->channel);
 
+    p_ctrl->p_queue     = NULL;
+    p_ctrl->queue_count = 0U;
+    p_ctrl->queue_index = 0U;
+
     /* Configure hardware registers according to the r_spi_api configuration structure. */
     r_spi_b_hw_config(p_ctrl);
 
@@ -247,6 +262,70 @@ fsp_err_t R_SPI_B_WriteRead (spi_ctrl_t * const    p_api_ctrl,
     return r_spi_b_write_read_common(p_api_ctrl, p_src, p_dest, length, bit_width);
 }
 
+/*******************************************************************************************************************//**
+ * Executes a queue of transactions back to back. Each transaction selects its own slave select line, bit width,
+ * length and buffers. The next transaction is started from the transfer end interrupt of the previous one, so the
+ * application does not have to restart the channel between transactions. SPI_EVENT_TRANSFER_COMPLETE is signaled
+ * once, after the last transaction in the queue is complete. An error stops the queue.
+ *
+ * The queue must remain valid until the callback is called. Slave select lines other than the one selected in
+ * @ref spi_b_extended_cfg_t::ssl_select are active low.
+ *
+ * @retval  FSP_SUCCESS                   The first transaction was started successfully.
+ * @retval  FSP_ERR_ASSERTION             NULL pointer to control or queue, count is zero, or a transaction in the
+ *                                        queue has no buffers or a length of zero.
+ * @retval  FSP_ERR_NOT_OPEN              The channel has not been opened. Open the channel first.
+ * @retval  FSP_ERR_UNSUPPORTED           The channel is not configured as a master.
+ * @retval  FSP_ERR_IN_USE                A transfer is already in progress.
+ * @return  See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally calls
+ *          @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+fsp_err_t R_SPI_B_TransactionQueueStart (spi_ctrl_t * const                p_api_ctrl,
+                                         spi_b_transaction_t const * const p_queue,
+                                         uint32_t const                    count)
+{
+    spi_b_instance_ctrl_t * p_ctrl = (spi_b_instance_ctrl_t *) p_api_ctrl;
+
+#if SPI_B_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(SPI_B_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_queue);
+    FSP_ASSERT(0U != count);
+    FSP_ERROR_RETURN(SPI_MODE_MASTER == p_ctrl->p_cfg->operating_mode, FSP_ERR_UNSUPPORTED);
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        FSP_ASSERT(p_queue[i].p_src || p_queue[i].p_dest);
+        FSP_ASSERT(0U != p_queue[i].length);
+ #if SPI_B_CFG_DMA_SUPPORT_ENABLE
+        fsp_err_t err = r_spi_b_transfer_length_check(p_ctrl, p_queue[i].length);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+ #endif
+    }
+#endif
+
+    /* Check to ensure SPE is cleared after the last transmission. */
+    FSP_ERROR_RETURN(0 == p_ctrl->p_regs->SPPSR, FSP_ERR_IN_USE);
+
+    p_ctrl->p_queue     = p_queue;
+    p_ctrl->queue_count = count;
+    p_ctrl->queue_index = 0U;
+
+    r_spi_b_ssl_select(p_ctrl, p_queue[0].ssl_select);
+
+    fsp_err_t err = r_spi_b_transfer_setup(p_ctrl,
+                                           p_queue[0].p_src,
+                                           p_queue[0].p_dest,
+                                           p_queue[0].length,
+                                           p_queue[0].bit_width);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->p_queue = NULL;
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * Updates the user callback and has option of providing memory for callback structure.
  * Implements spi_api_t::callbackSet
@@ -318,7 +397,8 @@ fsp_err_t R_SPI_B_Close (spi_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(SPI_B_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    p_ctrl->open = 0;
+    p_ctrl->open    = 0;
+    p_ctrl->p_queue = NULL;
 
 #if SPI_B_CFG_DMA_SUPPORT_ENABLE == 1
     if (NULL != p_ctrl->p_cfg->p_transfer_rx)
@@ -761,23 +841,8 @@ static fsp_err_t r_spi_b_write_read_common (spi_ctrl_t * const    p_api_ctrl,
     FSP_ASSERT(0 != length);
 
  #if SPI_B_CFG_DMA_SUPPORT_ENABLE
-    if (NULL != p_ctrl->p_cfg->p_transfer_rx)
-    {
-        transfer_properties_t transfer_info;
-        fsp_err_t             err = p_ctrl->p_cfg->p_transfer_rx->p_api->infoGet(p_ctrl->p_cfg->p_transfer_rx->p_ctrl,
-                                                                                 &transfer_info);
-        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
-        FSP_ASSERT(length <= transfer_info.transfer_length_max);
-    }
-
-    if (NULL != p_ctrl->p_cfg->p_transfer_tx)
-    {
-        transfer_properties_t transfer_info;
-        fsp_err_t             err = p_ctrl->p_cfg->p_transfer_tx->p_api->infoGet(p_ctrl->p_cfg->p_transfer_tx->p_ctrl,
-                                                                                 &transfer_info);
-        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
-        FSP_ASSERT(length <= transfer_info.transfer_length_max);
-    }
+    fsp_err_t err = r_spi_b_transfer_length_check(p_ctrl, length);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
  #endif
 #endif
 
@@ -785,6 +850,36 @@ static fsp_err_t r_spi_b_write_read_common (spi_ctrl_t * const    p_api_ctrl,
      * (see figure "Transmission flow in master mode" in the SPI section of the relevant hardware manual) */
     FSP_ERROR_RETURN(0 == p_ctrl->p_regs->SPPSR, FSP_ERR_IN_USE);
 
+    spi_b_extended_cfg_t * p_extend = ((spi_b_extended_cfg_t *) p_ctrl->p_cfg->p_extend);
+
+    /* A single transfer is not part of a transaction queue. A queue may have left another slave select line
+     * selected, so select the configured line again. */
+    p_ctrl->p_queue = NULL;
+    r_spi_b_ssl_select(p_ctrl, p_extend->ssl_select);
+
+    return r_spi_b_transfer_setup(p_ctrl, p_src, p_dest, length, bit_width);
+}
+
+/*******************************************************************************************************************//**
+ * Configures the driver state and the transfer instances, then initiates a SPI transfer. The caller must ensure SPE
+ * is cleared.
+ *
+ * @param[in]  p_ctrl            pointer to control structure.
+ * @param      p_src             Buffer to transmit data from.
+ * @param      p_dest            Buffer to store received data in.
+ * @param[in]  length            Number of transfers
+ * @param[in]  bit_width         Data frame size (8-Bit, 16-Bit, 32-Bit)
+ *
+ * @retval     FSP_SUCCESS       Transfer was started successfully.
+ * @return                       See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                               calls @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_b_transfer_setup (spi_b_instance_ctrl_t * const p_ctrl,
+                                         void const                  * p_src,
+                                         void                        * p_dest,
+                                         uint32_t const                length,
+                                         spi_bit_width_t const         bit_width)
+{
     p_ctrl->p_tx_data = p_src;
     p_ctrl->p_rx_data = p_dest;
     p_ctrl->tx_count  = 0;
@@ -869,6 +964,60 @@ static fsp_err_t r_spi_b_write_read_common (spi_ctrl_t * const    p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Selects the slave select line asserted by the next transfer. SPE must be cleared.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  ssl_select      Slave select line.
+ **********************************************************************************************************************/
+static void r_spi_b_ssl_select (spi_b_instance_ctrl_t * const p_ctrl, spi_b_ssl_select_t ssl_select)
+{
+    uint32_t spcmd0 = p_ctrl->p_regs->SPCMD0;
+
+    spcmd0 &= ~R_SPI_B0_SPCMD0_SSLA_Msk;
+    spcmd0 |= (uint32_t) ssl_select << R_SPI_B0_SPCMD0_SSLA_Pos;
+
+    p_ctrl->p_regs->SPCMD0 = spcmd0;
+}
+
+#if SPI_B_CFG_PARAM_CHECKING_ENABLE && SPI_B_CFG_DMA_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Verifies that the transfer length fits the configured transfer instances.
+ *
+ * @param[in]  p_ctrl            pointer to control structure.
+ * @param[in]  length            Number of transfers
+ *
+ * @retval     FSP_SUCCESS       The length is supported.
+ * @retval     FSP_ERR_ASSERTION The length exceeds the maximum length of a transfer instance.
+ * @return                       See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                               calls @ref transfer_api_t::infoGet.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_b_transfer_length_check (spi_b_instance_ctrl_t * const p_ctrl, uint32_t const length)
+{
+    if (NULL != p_ctrl->p_cfg->p_transfer_rx)
+    {
+        transfer_properties_t transfer_info;
+        fsp_err_t             err = p_ctrl->p_cfg->p_transfer_rx->p_api->infoGet(p_ctrl->p_cfg->p_transfer_rx->p_ctrl,
+                                                                                 &transfer_info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        FSP_ASSERT(length <= transfer_info.transfer_length_max);
+    }
+
+    if (NULL != p_ctrl->p_cfg->p_transfer_tx)
+    {
+        transfer_properties_t transfer_info;
+        fsp_err_t             err = p_ctrl->p_cfg->p_transfer_tx->p_api->infoGet(p_ctrl->p_cfg->p_transfer_tx->p_ctrl,
+                                                                                 &transfer_info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        FSP_ASSERT(length <= transfer_info.transfer_length_max);
+    }
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Copy configured bit width from the SPI data register to the current rx data location.
  * If the receive buffer is NULL, just read the SPI data register.
@@ -1138,8 +1287,41 @@ void spi_b_tei_isr (void)
             p_ctrl->p_regs->SPCR_b.SPE = 0;
         }
 
-        /* Signal that a transfer has completed. */
-        r_spi_b_call_callback(p_ctrl, SPI_EVENT_TRANSFER_COMPLETE);
+        spi_event_t event      = SPI_EVENT_TRANSFER_COMPLETE;
+        bool        next_start = false;
+
+        if (NULL != p_ctrl->p_queue)
+        {
+            uint32_t next_index = p_ctrl->queue_index + 1U;
+
+            if (next_index < p_ctrl->queue_count)
+            {
+                /* Start the next transaction in the queue without returning to the application. */
+                spi_b_transaction_t const * p_next = &p_ctrl->p_queue[next_index];
+                p_ctrl->queue_index = next_index;
+
+                r_spi_b_ssl_select(p_ctrl, p_next->ssl_select);
+
+                fsp_err_t err = r_spi_b_transfer_setup(p_ctrl,
+                                                       p_next->p_src,
+                                                       p_next->p_dest,
+                                                       p_next->length,
+                                                       p_next->bit_width);
+                next_start = (FSP_SUCCESS == err);
+                event      = SPI_EVENT_TRANSFER_ABORTED;
+            }
+
+            if (!next_start)
+            {
+                p_ctrl->p_queue = NULL;
+            }
+        }
+
+        if (!next_start)
+        {
+            /* Signal that a transfer (or the last transaction in the queue) has completed. */
+            r_spi_b_call_callback(p_ctrl, event);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -1176,6 +1358,9 @@ void spi_b_eri_isr (void)
         p_ctrl->p_regs->SPCR_b.SPE = 0;
     }
 
+    /* An error stops the transaction queue. */
+    p_ctrl->p_queue = NULL;
+
     /* Read the status register. */
     uint32_t status = p_ctrl->p_regs->SPSR;
 
@@ -0,0 +1,580 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_adc_pipeline.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "ADPL" in ASCII, used to determine if the pipeline is open. */
+#define ADC_PIPELINE_OPEN                (0x4144504CU)
+
+/* Instances opened by the pipeline, see adc_pipeline_instance_ctrl_t::opened. */
+#define ADC_PIPELINE_OPENED_ADC          (1U << 0)
+#define ADC_PIPELINE_OPENED_TRANSFER     (1U << 1)
+#define ADC_PIPELINE_OPENED_TIMER        (1U << 2)
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t rm_adc_pipeline_configure(adc_pipeline_instance_ctrl_t * const p_ctrl);
+static uint32_t  rm_adc_pipeline_cycles(void);
+static void      rm_adc_pipeline_release(adc_pipeline_instance_ctrl_t * const p_ctrl);
+static void      rm_adc_pipeline_transfer_callback(transfer_callback_args_t * p_args);
+static void      rm_adc_pipeline_filter(adc_pipeline_instance_ctrl_t * const p_ctrl,
+                                        adc_pipeline_filter_cfg_t const    * p_filter_cfg,
+                                        adc_pipeline_filter_state_t        * p_state,
+                                        uint16_t const                     * p_samples);
+
+#if ADC_PIPELINE_IIR_SUPPORTED
+static void rm_adc_pipeline_iir(adc_pipeline_filter_cfg_t const * p_filter_cfg, uint32_t first, uint32_t count);
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup ADC_PIPELINE
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Open the ADC, timer and transfer instances of the pipeline and connect them. The timer event is linked to the ADC
+ * start trigger through the ELC, and the transfer instance moves the results of each scan into the sample buffer.
+ * The CPU is only interrupted once per segment of scans_per_callback scans.
+ *
+ * The transfer instance must support @ref transfer_api_t::callbackSet and block mode, and the number of channels in
+ * the scan must not exceed its block length.
+ *
+ * The transfer is rearmed for the next segment from its transfer end interrupt. A scan that ends before the rearm, that
+ * is within the interrupt latency of the last scan of a segment, is not transferred and is lost. Pace the scans with a
+ * period longer than that latency.
+ *
+ * @retval FSP_SUCCESS              Pipeline opened. Call @ref RM_ADC_PIPELINE_Start to start sampling.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN     The pipeline is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The channel configuration does not select any channel, the sample buffer cannot
+ *                                  hold num_scans scans, the output buffer of a stage cannot hold the outputs of one
+ *                                  segment, or the oversampled or averaged sum of a stage can overflow.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref adc_api_t::open
+ *             * @ref adc_api_t::scanCfg
+ *             * @ref adc_api_t::infoGet
+ *             * @ref transfer_api_t::open
+ *             * @ref transfer_api_t::callbackSet
+ *             * @ref transfer_api_t::reconfigure
+ *             * @ref timer_api_t::open
+ *             * @ref elc_api_t::linkSet
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_Open (adc_pipeline_instance_ctrl_t * const p_ctrl, adc_pipeline_cfg_t const * const p_cfg)
+{
+#if ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ERROR_RETURN(ADC_PIPELINE_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ASSERT(NULL != p_cfg->p_adc);
+    FSP_ASSERT(NULL != p_cfg->p_adc_channel_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_timer);
+    FSP_ASSERT(NULL != p_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_cfg->p_elc);
+    FSP_ASSERT(NULL != p_cfg->p_buffer);
+    FSP_ASSERT(0U != p_cfg->num_scans);
+    FSP_ASSERT(0U != p_cfg->scans_per_callback);
+    FSP_ASSERT(p_cfg->scans_per_callback <= UINT16_MAX);
+    FSP_ASSERT(0U == (p_cfg->num_scans % p_cfg->scans_per_callback));
+    FSP_ASSERT((0U == p_cfg->num_filters) || (NULL != p_cfg->p_filter_cfg));
+    FSP_ASSERT((0U == p_cfg->num_filters) || (NULL != p_cfg->p_filter_state));
+    for (uint32_t i = 0U; i < p_cfg->num_filters; i++)
+    {
+        adc_pipeline_filter_cfg_t const * p_filter_cfg = &p_cfg->p_filter_cfg[i];
+        FSP_ASSERT(0U != p_filter_cfg->oversample);
+        FSP_ASSERT((p_filter_cfg->average_length <= 1U) || (NULL != p_filter_cfg->p_average_history));
+        FSP_ASSERT(NULL != p_filter_cfg->p_output);
+        FSP_ASSERT(0U != p_filter_cfg->output_length);
+
+        /* One segment must not lap the output buffer, or the IIR would filter past its end. */
+        uint32_t segment_outputs = (p_cfg->scans_per_callback + p_filter_cfg->oversample - 1U) /
+                                   p_filter_cfg->oversample;
+        FSP_ERROR_RETURN(p_filter_cfg->output_length >= segment_outputs, FSP_ERR_INVALID_ARGUMENT);
+
+        /* The decimated value and the moving average sum are 32-bit, so check them for full scale 16-bit samples. */
+        uint64_t peak = ((uint64_t) p_filter_cfg->oversample * UINT16_MAX) >> p_filter_cfg->oversample_shift;
+        if (p_filter_cfg->average_length > 1U)
+        {
+            peak *= p_filter_cfg->average_length;
+        }
+
+        FSP_ERROR_RETURN(peak <= (uint64_t) INT32_MAX, FSP_ERR_INVALID_ARGUMENT);
+    }
+#endif
+
+    p_ctrl->p_cfg              = p_cfg;
+    p_ctrl->opened             = 0U;
+    p_ctrl->segment            = 0U;
+    p_ctrl->segments_completed = 0U;
+
+    for (uint32_t i = 0U; i < p_cfg->num_filters; i++)
+    {
+        adc_pipeline_filter_state_t * p_state = &p_cfg->p_filter_state[i];
+        p_state->oversample_sum      = 0;
+        p_state->oversample_count    = 0U;
+        p_state->average_sum         = 0;
+        p_state->average_index       = 0U;
+        p_state->output_index        = 0U;
+        p_state->outputs_total       = 0U;
+        p_state->decimate_cycles_max = 0U;
+        p_state->iir_cycles_max      = 0U;
+    }
+
+    fsp_err_t err = rm_adc_pipeline_configure(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        /* Close the instances that were opened before the failure. */
+        rm_adc_pipeline_release(p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->open = ADC_PIPELINE_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Enable the ADC hardware trigger and start the timer that paces the scans.
+ *
+ * @retval FSP_SUCCESS              Sampling started.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pipeline is not open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref adc_api_t::scanStart
+ *             * @ref timer_api_t::start
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_Start (adc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(ADC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    adc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    fsp_err_t err = p_cfg->p_adc->p_api->scanStart(p_cfg->p_adc->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return p_cfg->p_timer->p_api->start(p_cfg->p_timer->p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Stop the timer and disable the ADC hardware trigger. The transfer remains armed, so sampling resumes in the same
+ * segment when @ref RM_ADC_PIPELINE_Start is called again.
+ *
+ * @retval FSP_SUCCESS              Sampling stopped.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pipeline is not open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref timer_api_t::stop
+ *             * @ref adc_api_t::scanStop
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_Stop (adc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(ADC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    adc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    fsp_err_t err = p_cfg->p_timer->p_api->stop(p_cfg->p_timer->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return p_cfg->p_adc->p_api->scanStop(p_cfg->p_adc->p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Get a de-interleaved view of one channel over a range of scans in the sample buffer. Use
+ * @ref ADC_PIPELINE_VIEW_SAMPLE to read the samples of the view.
+ *
+ * channel_index is the offset of the ADC data register from the lowest channel in the scan. Registers of channels
+ * between the lowest and highest scanned channel are transferred even if they are not scanned.
+ *
+ * @retval FSP_SUCCESS              View stored in p_view.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pipeline is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The channel or scan range is outside of the sample buffer.
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_ChannelViewGet (adc_pipeline_instance_ctrl_t * const p_ctrl,
+                                          uint32_t                             channel_index,
+                                          uint32_t                             first_scan,
+                                          uint32_t                             num_scans,
+                                          adc_pipeline_view_t * const          p_view)
+{
+#if ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_view);
+    FSP_ERROR_RETURN(ADC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    adc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    FSP_ERROR_RETURN(channel_index < p_ctrl->num_channels, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((first_scan <= p_cfg->num_scans) && (num_scans <= (p_cfg->num_scans - first_scan)),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    p_view->p_data = &p_cfg->p_buffer[(first_scan * p_ctrl->num_channels) + channel_index];
+    p_view->stride = p_ctrl->num_channels;
+    p_view->count  = num_scans;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stop sampling, break the ELC link and close the ADC, timer and transfer instances opened by
+ * @ref RM_ADC_PIPELINE_Open.
+ *
+ * @retval FSP_SUCCESS              Pipeline closed.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The pipeline is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_ADC_PIPELINE_Close (adc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+#if ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(ADC_PIPELINE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    adc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    p_ctrl->open = 0U;
+
+    p_cfg->p_elc->p_api->linkBreak(p_cfg->p_elc->p_ctrl, p_cfg->elc_peripheral);
+    rm_adc_pipeline_release(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup ADC_PIPELINE)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Open and connect the instances used by the pipeline. Each instance opened here is recorded in
+ * adc_pipeline_instance_ctrl_t::opened, so that an instance already opened by the application is never closed.
+ *
+ * @param[in]  p_ctrl                  Pointer to the pipeline control block.
+ *
+ * @retval FSP_SUCCESS                 All instances opened and connected.
+ * @retval FSP_ERR_INVALID_ARGUMENT    The channel configuration does not select any channel, or the sample buffer
+ *                                     cannot hold num_scans scans.
+ * @return Error code of the first instance call that failed.
+ **********************************************************************************************************************/
+static fsp_err_t rm_adc_pipeline_configure (adc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+    adc_pipeline_cfg_t const  * p_cfg      = p_ctrl->p_cfg;
+    adc_instance_t const      * p_adc      = p_cfg->p_adc;
+    transfer_instance_t const * p_transfer = p_cfg->p_transfer;
+    adc_info_t                  info;
+
+    fsp_err_t err = p_adc->p_api->open(p_adc->p_ctrl, p_adc->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    p_ctrl->opened |= ADC_PIPELINE_OPENED_ADC;
+
+    err = p_adc->p_api->scanCfg(p_adc->p_ctrl, p_cfg->p_adc_channel_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* The ADC reports the first data register and the number of registers that cover all scanned channels. */
+    err = p_adc->p_api->infoGet(p_adc->p_ctrl, &info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(0U != info.length, FSP_ERR_INVALID_ARGUMENT);
+
+    /* The buffer holds num_scans scans of info.length samples. */
+    FSP_ERROR_RETURN((p_cfg->buffer_length / info.length) >= p_cfg->num_scans, FSP_ERR_INVALID_ARGUMENT);
+
+    p_ctrl->p_adc_data   = (void const *) info.p_address;
+    p_ctrl->num_channels = info.length;
+
+    /* Each scan end moves one block of results. The source returns to the first data register after each block and
+     * the destination advances through the segment. */
+    p_ctrl->transfer_info.transfer_settings_word                  = 0U;
+    p_ctrl->transfer_info.transfer_settings_word_b.mode           = TRANSFER_MODE_BLOCK;
+    p_ctrl->transfer_info.transfer_settings_word_b.size           = info.transfer_size;
+    p_ctrl->transfer_info.transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_ctrl->transfer_info.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_ctrl->transfer_info.transfer_settings_word_b.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_ctrl->transfer_info.transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    p_ctrl->transfer_info.p_src      = p_ctrl->p_adc_data;
+    p_ctrl->transfer_info.p_dest     = p_cfg->p_buffer;
+    p_ctrl->transfer_info.length     = (uint16_t) info.length;
+    p_ctrl->transfer_info.num_blocks = (uint16_t) p_cfg->scans_per_callback;
+
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    p_ctrl->opened |= ADC_PIPELINE_OPENED_TRANSFER;
+
+    /* Register the callback before the transfer is configured so the transfer end interrupt is enabled. */
+    err = p_transfer->p_api->callbackSet(p_transfer->p_ctrl, rm_adc_pipeline_transfer_callback, p_ctrl, NULL);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_ctrl->transfer_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_cfg->p_timer->p_api->open(p_cfg->p_timer->p_ctrl, p_cfg->p_timer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    p_ctrl->opened |= ADC_PIPELINE_OPENED_TIMER;
+
+    return p_cfg->p_elc->p_api->linkSet(p_cfg->p_elc->p_ctrl, p_cfg->elc_peripheral, p_cfg->elc_event);
+}
+
+/*******************************************************************************************************************//**
+ * Stop and close the instances opened by the pipeline. Instances opened by the application are left untouched.
+ *
+ * @param[in]  p_ctrl                  Pointer to the pipeline control block.
+ **********************************************************************************************************************/
+static void rm_adc_pipeline_release (adc_pipeline_instance_ctrl_t * const p_ctrl)
+{
+    adc_pipeline_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    if (0U != (p_ctrl->opened & ADC_PIPELINE_OPENED_TIMER))
+    {
+        p_cfg->p_timer->p_api->stop(p_cfg->p_timer->p_ctrl);
+        p_cfg->p_timer->p_api->close(p_cfg->p_timer->p_ctrl);
+    }
+
+    if (0U != (p_ctrl->opened & ADC_PIPELINE_OPENED_ADC))
+    {
+        p_cfg->p_adc->p_api->scanStop(p_cfg->p_adc->p_ctrl);
+    }
+
+    if (0U != (p_ctrl->opened & ADC_PIPELINE_OPENED_TRANSFER))
+    {
+        p_cfg->p_transfer->p_api->close(p_cfg->p_transfer->p_ctrl);
+    }
+
+    if (0U != (p_ctrl->opened & ADC_PIPELINE_OPENED_ADC))
+    {
+        p_cfg->p_adc->p_api->close(p_cfg->p_adc->p_ctrl);
+    }
+
+    p_ctrl->opened = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Transfer end callback. Rearms the transfer for the next segment and reports the completed segment.
+ *
+ * @param[in]  p_args                  Callback arguments. p_context points to the pipeline control block.
+ **********************************************************************************************************************/
+static void rm_adc_pipeline_transfer_callback (transfer_callback_args_t * p_args)
+{
+    adc_pipeline_instance_ctrl_t * p_ctrl = (adc_pipeline_instance_ctrl_t *) p_args->p_context;
+    adc_pipeline_cfg_t const     * p_cfg  = p_ctrl->p_cfg;
+
+    uint32_t completed    = p_ctrl->segment;
+    uint32_t num_segments = p_cfg->num_scans / p_cfg->scans_per_callback;
+    uint32_t next         = completed + 1U;
+    if (next >= num_segments)
+    {
+        next = 0U;
+    }
+
+    p_ctrl->segment = next;
+
+    /* Rearm the transfer before anything else to keep the window in which a scan end is not transferred short. A scan
+     * that ended between the transfer end and this reset has already been missed; see RM_ADC_PIPELINE_Open. */
+    uint16_t * p_next_dest = &p_cfg->p_buffer[next * p_cfg->scans_per_callback * p_ctrl->num_channels];
+    p_cfg->p_transfer->p_api->reset(p_cfg->p_transfer->p_ctrl,
+                                    p_ctrl->p_adc_data,
+                                    p_next_dest,
+                                    (uint16_t) p_cfg->scans_per_callback);
+
+    p_ctrl->segments_completed++;
+
+    uint32_t         first_scan = completed * p_cfg->scans_per_callback;
+    uint16_t const * p_samples  = &p_cfg->p_buffer[first_scan * p_ctrl->num_channels];
+
+    for (uint32_t i = 0U; i < p_cfg->num_filters; i++)
+    {
+        rm_adc_pipeline_filter(p_ctrl, &p_cfg->p_filter_cfg[i], &p_cfg->p_filter_state[i], p_samples);
+    }
+
+    if (NULL != p_cfg->p_callback)
+    {
+        adc_pipeline_callback_args_t args;
+        uint32_t end_scan = first_scan + p_cfg->scans_per_callback;
+
+        args.event = (uint32_t) ADC_PIPELINE_EVENT_SEGMENT_COMPLETE;
+        if ((end_scan * 2U) == p_cfg->num_scans)
+        {
+            args.event |= (uint32_t) ADC_PIPELINE_EVENT_HALF_BUFFER;
+        }
+
+        if (end_scan == p_cfg->num_scans)
+        {
+            args.event |= (uint32_t) ADC_PIPELINE_EVENT_FULL_BUFFER;
+        }
+
+        args.p_samples  = p_samples;
+        args.first_scan = first_scan;
+        args.num_scans  = p_cfg->scans_per_callback;
+        args.p_context  = p_cfg->p_context;
+
+        p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Run a post-processing stage over one segment. The cost is constant per input sample: one addition for oversampling,
+ * and per output sample one update of the moving average sum and one pass of the IIR on the MACL.
+ *
+ * @param[in]  p_ctrl                  Pointer to the pipeline control block.
+ * @param[in]  p_filter_cfg            Stage configuration.
+ * @param[in]  p_state                 Stage state.
+ * @param[in]  p_samples               First sample of the completed segment.
+ **********************************************************************************************************************/
+static void rm_adc_pipeline_filter (adc_pipeline_instance_ctrl_t * const p_ctrl,
+                                    adc_pipeline_filter_cfg_t const    * p_filter_cfg,
+                                    adc_pipeline_filter_state_t        * p_state,
+                                    uint16_t const                     * p_samples)
+{
+    uint32_t         num_scans    = p_ctrl->p_cfg->scans_per_callback;
+    uint32_t         stride       = p_ctrl->num_channels;
+    uint16_t const * p_sample     = &p_samples[p_filter_cfg->channel_index];
+    uint32_t         output_index = p_state->output_index;
+    uint32_t         first_output = output_index;
+    uint32_t         num_outputs  = 0U;
+    uint32_t         start        = rm_adc_pipeline_cycles();
+
+    for (uint32_t scan = 0U; scan < num_scans; scan++)
+    {
+        /* Oversample and decimate. */
+        p_state->oversample_sum += (int64_t) p_sample[scan * stride];
+        p_state->oversample_count++;
+        if (p_state->oversample_count < p_filter_cfg->oversample)
+        {
+            continue;
+        }
+
+        int32_t value = (int32_t) (p_state->oversample_sum >> p_filter_cfg->oversample_shift);
+        p_state->oversample_sum   = 0;
+        p_state->oversample_count = 0U;
+
+        /* Moving average over the last average_length decimated samples. */
+        if (p_filter_cfg->average_length > 1U)
+        {
+            int32_t * p_history = &p_filter_cfg->p_average_history[p_state->average_index];
+            p_state->average_sum += value - *p_history;
+            *p_history            = value;
+
+            p_state->average_index++;
+            if (p_state->average_index >= p_filter_cfg->average_length)
+            {
+                p_state->average_index = 0U;
+            }
+
+            value = p_state->average_sum / (int32_t) p_filter_cfg->average_length;
+        }
+
+#if ADC_PIPELINE_IIR_SUPPORTED
+        if (NULL != p_filter_cfg->p_iir)
+        {
+            value = (int32_t) ((uint32_t) value << p_filter_cfg->iir_input_shift);
+        }
+#endif
+
+        p_filter_cfg->p_output[output_index] = value;
+        output_index++;
+        if (output_index >= p_filter_cfg->output_length)
+        {
+            output_index = 0U;
+        }
+
+        num_outputs++;
+    }
+
+    uint32_t cycles = rm_adc_pipeline_cycles() - start;
+    if (cycles > p_state->decimate_cycles_max)
+    {
+        p_state->decimate_cycles_max = cycles;
+    }
+
+#if ADC_PIPELINE_IIR_SUPPORTED
+    if ((NULL != p_filter_cfg->p_iir) && (0U != num_outputs))
+    {
+        start = rm_adc_pipeline_cycles();
+        rm_adc_pipeline_iir(p_filter_cfg, first_output, num_outputs);
+
+        cycles = rm_adc_pipeline_cycles() - start;
+        if (cycles > p_state->iir_cycles_max)
+        {
+            p_state->iir_cycles_max = cycles;
+        }
+    }
+
+#else
+    FSP_PARAMETER_NOT_USED(first_output);
+#endif
+
+    p_state->output_index   = output_index;
+    p_state->outputs_total += num_outputs;
+}
+
+/*******************************************************************************************************************//**
+ * Read the CPU cycle counter. The DWT cycle counter must be enabled by the application to measure the stage cost.
+ *
+ * @return Current value of the cycle counter, or 0 if the device has no cycle counter.
+ **********************************************************************************************************************/
+static uint32_t rm_adc_pipeline_cycles (void)
+{
+#if BSP_FEATURE_DWT_CYCCNT
+    return DWT->CYCCNT;
+#else
+    return 0U;
+#endif
+}
+
+#if ADC_PIPELINE_IIR_SUPPORTED
+
+/*******************************************************************************************************************//**
+ * Run the IIR in place over new samples of the output buffer. Samples that wrap around the end of the buffer are
+ * filtered in a second block. The biquad state holds the last two inputs and outputs of each stage, so the blocks and
+ * segments join into one continuous stream.
+ *
+ * @param[in]  p_filter_cfg            Stage configuration.
+ * @param[in]  first                   Position of the first new sample in the output buffer.
+ * @param[in]  count                   Number of new samples.
+ **********************************************************************************************************************/
+static void rm_adc_pipeline_iir (adc_pipeline_filter_cfg_t const * p_filter_cfg, uint32_t first, uint32_t count)
+{
+    uint32_t block = p_filter_cfg->output_length - first;
+    if (block > count)
+    {
+        block = count;
+    }
+
+    R_BSP_MaclBiquadCsdDf1Q31(p_filter_cfg->p_iir,
+                              &p_filter_cfg->p_output[first],
+                              &p_filter_cfg->p_output[first],
+                              block);
+
+    if (count > block)
+    {
+        R_BSP_MaclBiquadCsdDf1Q31(p_filter_cfg->p_iir, p_filter_cfg->p_output, p_filter_cfg->p_output, count - block);
+    }
+}
+
+#endif
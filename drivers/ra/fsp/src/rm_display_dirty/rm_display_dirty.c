@@ -0,0 +1,612 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_display_dirty.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "DRTY" in ASCII, used to determine if the tracker is open. */
+#define DISPLAY_DIRTY_OPEN               (0x44525459U)
+
+/* Largest high speed command payload accepted by the MIPI DSI sequence channel. */
+#define DISPLAY_DIRTY_PACKET_SIZE_MAX    (1024U)
+
+/* Size of the column and page address set payloads: DCS command followed by the start and end address. */
+#define DISPLAY_DIRTY_WINDOW_SIZE        (5U)
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t  rm_display_dirty_area(display_dirty_rect_t const * p_rect);
+static void      rm_display_dirty_union(display_dirty_rect_t * p_dest, display_dirty_rect_t const * p_rect);
+static void      rm_display_dirty_merge(display_dirty_instance_ctrl_t * const p_ctrl, display_dirty_rect_t rect);
+static fsp_err_t rm_display_dirty_dcs_write(display_dirty_instance_ctrl_t * const p_ctrl,
+                                            uint8_t const * const                 p_payload,
+                                            uint32_t                              length);
+static fsp_err_t rm_display_dirty_window_send(display_dirty_instance_ctrl_t * const p_ctrl,
+                                              uint8_t const * const                 p_frame,
+                                              display_dirty_rect_t const * const    p_rect);
+static fsp_err_t rm_display_dirty_copy(display_dirty_instance_ctrl_t * const p_ctrl,
+                                       uint8_t * const                       p_dest,
+                                       uint8_t const * const                 p_src,
+                                       uint32_t                              bytes);
+
+/*******************************************************************************************************************//**
+ * @addtogroup DISPLAY_DIRTY
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Open the dirty rectangle tracker. In video mode the transfer instance is opened if one is configured. The MIPI DSI
+ * and display instances are used as they are and must be opened by the application.
+ *
+ * @retval FSP_SUCCESS              Tracker opened.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_ALREADY_OPEN     The tracker is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT packet_size cannot hold a pixel or exceeds the high speed command size.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref transfer_api_t::open
+ *             * @ref transfer_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_Open (display_dirty_instance_ctrl_t * const p_ctrl, display_dirty_cfg_t const * const p_cfg)
+{
+#if DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ASSERT(0U != p_cfg->hsize);
+    FSP_ASSERT(0U != p_cfg->vsize);
+    FSP_ASSERT(0U != p_cfg->bytes_per_pixel);
+    FSP_ASSERT(p_cfg->hstride >= ((uint32_t) p_cfg->hsize * p_cfg->bytes_per_pixel));
+    FSP_ASSERT(0U != p_cfg->alignment);
+    FSP_ASSERT(0U == (p_cfg->alignment & (p_cfg->alignment - 1U)));
+    FSP_ASSERT(NULL != p_cfg->p_rects);
+    FSP_ASSERT(0U != p_cfg->max_rects);
+    if (DISPLAY_DIRTY_MODE_COMMAND == p_cfg->mode)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_mipi_dsi);
+        FSP_ASSERT(NULL != p_cfg->p_packet_buffer);
+        FSP_ERROR_RETURN(p_cfg->packet_size > p_cfg->bytes_per_pixel, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(p_cfg->packet_size <= DISPLAY_DIRTY_PACKET_SIZE_MAX, FSP_ERR_INVALID_ARGUMENT);
+    }
+    else
+    {
+        FSP_ASSERT(NULL != p_cfg->p_display);
+        FSP_ASSERT(NULL != p_cfg->p_sync_rects);
+    }
+#endif
+
+    p_ctrl->p_cfg          = p_cfg;
+    p_ctrl->num_rects      = 0U;
+    p_ctrl->num_sync_rects = 0U;
+    p_ctrl->p_sync_src     = NULL;
+    p_ctrl->packet_index   = 0U;
+    p_ctrl->transfer_max   = 0U;
+
+    if ((DISPLAY_DIRTY_MODE_VIDEO == p_cfg->mode) && (NULL != p_cfg->p_transfer))
+    {
+        transfer_instance_t const * p_transfer = p_cfg->p_transfer;
+        transfer_properties_t       properties;
+
+        fsp_err_t err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+        if (FSP_SUCCESS != err)
+        {
+            p_transfer->p_api->close(p_transfer->p_ctrl);
+
+            return err;
+        }
+
+        /* Copies are split so that each one fits in the normal mode transfer length. */
+        p_ctrl->transfer_max = (properties.transfer_length_max < UINT16_MAX) ?
+                               properties.transfer_length_max : UINT16_MAX;
+    }
+
+    p_ctrl->open = DISPLAY_DIRTY_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Mark a region of the frame being drawn as dirty. The region is clipped to the frame and widened to the configured
+ * alignment, then merged with the tracked rectangles that it overlaps or nearly touches. When all max_rects entries
+ * are in use, the region is merged with the rectangle that grows the least.
+ *
+ * @retval FSP_SUCCESS              Region added. Regions outside of the frame are ignored.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The tracker is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_RectAdd (display_dirty_instance_ctrl_t * const p_ctrl,
+                                    display_dirty_rect_t const * const    p_rect)
+{
+#if DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_rect);
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    display_dirty_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t                    mask  = ~((uint32_t) p_cfg->alignment - 1U);
+
+    if ((p_rect->x >= p_cfg->hsize) || (p_rect->y >= p_cfg->vsize) || (0U == p_rect->width) ||
+        (0U == p_rect->height))
+    {
+        return FSP_SUCCESS;
+    }
+
+    uint32_t x_start = (uint32_t) p_rect->x & mask;
+    uint32_t y_start = (uint32_t) p_rect->y & mask;
+    uint32_t x_end   = ((uint32_t) p_rect->x + p_rect->width + p_cfg->alignment - 1U) & mask;
+    uint32_t y_end   = ((uint32_t) p_rect->y + p_rect->height + p_cfg->alignment - 1U) & mask;
+
+    x_end = (x_end < p_cfg->hsize) ? x_end : p_cfg->hsize;
+    y_end = (y_end < p_cfg->vsize) ? y_end : p_cfg->vsize;
+
+    display_dirty_rect_t rect =
+    {
+        .x      = (uint16_t) x_start,
+        .y      = (uint16_t) y_start,
+        .width  = (uint16_t) (x_end - x_start),
+        .height = (uint16_t) (y_end - y_start),
+    };
+
+    rm_display_dirty_merge(p_ctrl, rect);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Present the dirty regions of a completed frame and start tracking the next frame.
+ *
+ * In command mode each dirty rectangle is sent to the panel as a column and page address set followed by memory
+ * write packets of the rectangle pixels. The pixels are copied into the two packet buffers so that the next packet
+ * is prepared while the previous one is transmitted. The frame buffer pixels must be in the byte order expected by
+ * the panel.
+ *
+ * In video mode the display is switched to p_frame and the dirty rectangles are kept until they are copied to the
+ * new back buffer with @ref RM_DISPLAY_DIRTY_BufferSync.
+ *
+ * @retval FSP_SUCCESS              Dirty regions presented.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The tracker is not open.
+ * @retval FSP_ERR_IN_USE           Video mode only. The rectangles of the previous frame were not synchronized yet.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref mipi_dsi_api_t::command
+ *             * @ref display_api_t::bufferChange
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_Flush (display_dirty_instance_ctrl_t * const p_ctrl, uint8_t * const p_frame)
+{
+#if DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frame);
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    display_dirty_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    fsp_err_t                   err   = FSP_SUCCESS;
+
+    if (DISPLAY_DIRTY_MODE_COMMAND == p_cfg->mode)
+    {
+        for (uint32_t i = 0U; (i < p_ctrl->num_rects) && (FSP_SUCCESS == err); i++)
+        {
+            err = rm_display_dirty_window_send(p_ctrl, p_frame, &p_cfg->p_rects[i]);
+        }
+
+        /* A failed frame is not retried, the next frame redraws its own regions. */
+        p_ctrl->num_rects = 0U;
+
+        return err;
+    }
+
+    FSP_ERROR_RETURN(0U == p_ctrl->num_sync_rects, FSP_ERR_IN_USE);
+
+    err = p_cfg->p_display->p_api->bufferChange(p_cfg->p_display->p_ctrl, p_frame, p_cfg->layer);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* The regions drawn in this frame are missing from the other buffer until it is synchronized. */
+    memcpy(p_cfg->p_sync_rects, p_cfg->p_rects, p_ctrl->num_rects * sizeof(display_dirty_rect_t));
+    p_ctrl->num_sync_rects = p_ctrl->num_rects;
+    p_ctrl->p_sync_src     = p_frame;
+    p_ctrl->num_rects      = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Copy the regions changed in the last flushed frame into the new back buffer, so that only the regions dirtied in
+ * the next frame have to be drawn. Video mode only.
+ *
+ * Call this function after the display has switched to the flushed frame, for example from the vertical blanking
+ * callback of the display or before drawing the next frame. Rows are copied with the transfer instance when one is
+ * configured. Rectangles that span whole lines of a buffer without padding are copied as one block.
+ *
+ * @retval FSP_SUCCESS              Back buffer synchronized.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The tracker is not open.
+ * @retval FSP_ERR_UNSUPPORTED      The tracker is not in video mode.
+ * @retval FSP_ERR_INVALID_ARGUMENT p_frame is the frame buffer that is displayed.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *             * @ref transfer_api_t::reconfigure
+ *             * @ref transfer_api_t::softwareStart
+ *             * @ref transfer_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_BufferSync (display_dirty_instance_ctrl_t * const p_ctrl, uint8_t * const p_frame)
+{
+#if DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frame);
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    display_dirty_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_MODE_VIDEO == p_cfg->mode, FSP_ERR_UNSUPPORTED);
+    FSP_ERROR_RETURN(p_frame != p_ctrl->p_sync_src, FSP_ERR_INVALID_ARGUMENT);
+
+    uint32_t line_bytes = (uint32_t) p_cfg->hsize * p_cfg->bytes_per_pixel;
+
+    for (uint32_t i = 0U; i < p_ctrl->num_sync_rects; i++)
+    {
+        display_dirty_rect_t const * p_rect = &p_cfg->p_sync_rects[i];
+        uint32_t offset = ((uint32_t) p_rect->y * p_cfg->hstride) + ((uint32_t) p_rect->x * p_cfg->bytes_per_pixel);
+        uint32_t bytes  = (uint32_t) p_rect->width * p_cfg->bytes_per_pixel;
+        uint32_t rows   = p_rect->height;
+
+        /* Full width rectangles of an unpadded buffer are contiguous in memory. */
+        if ((bytes == line_bytes) && (line_bytes == p_cfg->hstride))
+        {
+            bytes *= rows;
+            rows   = 1U;
+        }
+
+        for (uint32_t row = 0U; row < rows; row++)
+        {
+            fsp_err_t err = rm_display_dirty_copy(p_ctrl, &p_frame[offset], &p_ctrl->p_sync_src[offset], bytes);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            offset += p_cfg->hstride;
+        }
+    }
+
+    p_ctrl->num_sync_rects = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Close the dirty rectangle tracker and the transfer instance it opened. Tracked rectangles are discarded.
+ *
+ * @retval FSP_SUCCESS              Tracker closed.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         The tracker is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_DISPLAY_DIRTY_Close (display_dirty_instance_ctrl_t * const p_ctrl)
+{
+#if DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(DISPLAY_DIRTY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    display_dirty_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    p_ctrl->open = 0U;
+
+    if ((DISPLAY_DIRTY_MODE_VIDEO == p_cfg->mode) && (NULL != p_cfg->p_transfer))
+    {
+        p_cfg->p_transfer->p_api->close(p_cfg->p_transfer->p_ctrl);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup DISPLAY_DIRTY)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Number of pixels covered by a rectangle.
+ *
+ * @param[in]  p_rect                  Rectangle.
+ **********************************************************************************************************************/
+static uint32_t rm_display_dirty_area (display_dirty_rect_t const * p_rect)
+{
+    return (uint32_t) p_rect->width * p_rect->height;
+}
+
+/*******************************************************************************************************************//**
+ * Grow a rectangle to the bounding box of itself and another rectangle.
+ *
+ * @param[in,out]  p_dest              Rectangle to grow.
+ * @param[in]      p_rect              Rectangle to include.
+ **********************************************************************************************************************/
+static void rm_display_dirty_union (display_dirty_rect_t * p_dest, display_dirty_rect_t const * p_rect)
+{
+    uint32_t x_start = (p_dest->x < p_rect->x) ? p_dest->x : p_rect->x;
+    uint32_t y_start = (p_dest->y < p_rect->y) ? p_dest->y : p_rect->y;
+    uint32_t x_end   = (uint32_t) p_dest->x + p_dest->width;
+    uint32_t y_end   = (uint32_t) p_dest->y + p_dest->height;
+
+    x_end = (x_end > ((uint32_t) p_rect->x + p_rect->width)) ? x_end : ((uint32_t) p_rect->x + p_rect->width);
+    y_end = (y_end > ((uint32_t) p_rect->y + p_rect->height)) ? y_end : ((uint32_t) p_rect->y + p_rect->height);
+
+    p_dest->x      = (uint16_t) x_start;
+    p_dest->y      = (uint16_t) y_start;
+    p_dest->width  = (uint16_t) (x_end - x_start);
+    p_dest->height = (uint16_t) (y_end - y_start);
+}
+
+/*******************************************************************************************************************//**
+ * Add a clipped rectangle to the tracked rectangles. Every tracked rectangle that can be merged with the new one
+ * within merge_slack is removed and merged into it. When the list is full, the tracked rectangle whose bounding box
+ * with the new one grows the least is merged as well.
+ *
+ * @param[in]  p_ctrl                  Pointer to the tracker control block.
+ * @param[in]  rect                    Clipped rectangle to add.
+ **********************************************************************************************************************/
+static void rm_display_dirty_merge (display_dirty_instance_ctrl_t * const p_ctrl, display_dirty_rect_t rect)
+{
+    display_dirty_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    display_dirty_rect_t      * p_rects = p_cfg->p_rects;
+
+    for ( ; ; )
+    {
+        uint32_t i = 0U;
+        while (i < p_ctrl->num_rects)
+        {
+            display_dirty_rect_t merged = p_rects[i];
+            rm_display_dirty_union(&merged, &rect);
+
+            uint64_t covered = (uint64_t) rm_display_dirty_area(&p_rects[i]) + rm_display_dirty_area(&rect);
+            if ((uint64_t) rm_display_dirty_area(&merged) <= (covered + p_cfg->merge_slack))
+            {
+                /* The merged rectangle may now reach rectangles that were checked already, so start over. */
+                rect       = merged;
+                p_rects[i] = p_rects[p_ctrl->num_rects - 1U];
+                p_ctrl->num_rects--;
+                i = 0U;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (p_ctrl->num_rects < p_cfg->max_rects)
+        {
+            p_rects[p_ctrl->num_rects] = rect;
+            p_ctrl->num_rects++;
+
+            return;
+        }
+
+        uint32_t best        = 0U;
+        uint32_t best_growth = UINT32_MAX;
+        for (i = 0U; i < p_ctrl->num_rects; i++)
+        {
+            display_dirty_rect_t merged = p_rects[i];
+            rm_display_dirty_union(&merged, &rect);
+
+            uint32_t growth = rm_display_dirty_area(&merged) - rm_display_dirty_area(&p_rects[i]);
+            if (growth < best_growth)
+            {
+                best        = i;
+                best_growth = growth;
+            }
+        }
+
+        rm_display_dirty_union(&rect, &p_rects[best]);
+        p_rects[best] = p_rects[p_ctrl->num_rects - 1U];
+        p_ctrl->num_rects--;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Send a DCS long write in high speed mode. The sequence channel reads the payload from memory, so the payload must
+ * stay valid until the next command is accepted.
+ *
+ * @param[in]  p_ctrl                  Pointer to the tracker control block.
+ * @param[in]  p_payload               DCS command followed by its parameters.
+ * @param[in]  length                  Size of the payload in bytes.
+ *
+ * @return Return code of @ref mipi_dsi_api_t::command.
+ **********************************************************************************************************************/
+static fsp_err_t rm_display_dirty_dcs_write (display_dirty_instance_ctrl_t * const p_ctrl,
+                                             uint8_t const * const                 p_payload,
+                                             uint32_t                              length)
+{
+    mipi_dsi_instance_t const * p_mipi_dsi = p_ctrl->p_cfg->p_mipi_dsi;
+    mipi_dsi_cmd_t              cmd        =
+    {
+        .channel     = p_ctrl->p_cfg->channel,
+        .cmd_id      = MIPI_CMD_ID_DCS_LONG_WRITE,
+        .flags       = MIPI_DSI_CMD_FLAG_NONE,
+        .tx_len      = (uint16_t) length,
+        .p_tx_buffer = p_payload,
+        .p_rx_buffer = NULL,
+    };
+    fsp_err_t err;
+
+    /* The command is refused while the previous packet is still being transmitted. */
+    do
+    {
+        err = p_mipi_dsi->p_api->command(p_mipi_dsi->p_ctrl, &cmd);
+    } while (FSP_ERR_IN_USE == err);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Send one dirty rectangle to a command mode panel. The panel write pointer wraps to the next row at the end of the
+ * window, so the rows are packed back to back and each packet carries whole pixels.
+ *
+ * @param[in]  p_ctrl                  Pointer to the tracker control block.
+ * @param[in]  p_frame                 Frame buffer holding the pixels.
+ * @param[in]  p_rect                  Rectangle to send.
+ *
+ * @return Return code of the first command that failed, or FSP_SUCCESS.
+ **********************************************************************************************************************/
+static fsp_err_t rm_display_dirty_window_send (display_dirty_instance_ctrl_t * const p_ctrl,
+                                               uint8_t const * const                 p_frame,
+                                               display_dirty_rect_t const * const    p_rect)
+{
+    display_dirty_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    uint8_t                   * p_col   = p_ctrl->window[0];
+    uint8_t                   * p_page  = p_ctrl->window[1];
+    uint32_t                    x_end   = (uint32_t) p_rect->x + p_rect->width - 1U;
+    uint32_t                    y_end   = (uint32_t) p_rect->y + p_rect->height - 1U;
+    uint32_t                    payload = ((p_cfg->packet_size - 1U) / p_cfg->bytes_per_pixel) * p_cfg->bytes_per_pixel;
+
+    p_col[0]  = MIPI_DSI_DCS_ID_SET_COLUMN_ADDRESS;
+    p_col[1]  = (uint8_t) (p_rect->x >> 8);
+    p_col[2]  = (uint8_t) (p_rect->x & UINT8_MAX);
+    p_col[3]  = (uint8_t) (x_end >> 8);
+    p_col[4]  = (uint8_t) (x_end & UINT8_MAX);
+    p_page[0] = MIPI_DSI_DCS_ID_SET_PAGE_ADDRESS;
+    p_page[1] = (uint8_t) (p_rect->y >> 8);
+    p_page[2] = (uint8_t) (p_rect->y & UINT8_MAX);
+    p_page[3] = (uint8_t) (y_end >> 8);
+    p_page[4] = (uint8_t) (y_end & UINT8_MAX);
+
+    fsp_err_t err = rm_display_dirty_dcs_write(p_ctrl, p_col, DISPLAY_DIRTY_WINDOW_SIZE);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = rm_display_dirty_dcs_write(p_ctrl, p_page, DISPLAY_DIRTY_WINDOW_SIZE);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint32_t        row_bytes = (uint32_t) p_rect->width * p_cfg->bytes_per_pixel;
+    uint8_t const * p_row     = &p_frame[((uint32_t) p_rect->y * p_cfg->hstride) +
+                                         ((uint32_t) p_rect->x * p_cfg->bytes_per_pixel)];
+    uint32_t row    = 0U;
+    uint32_t column = 0U;
+    uint8_t  dcs    = MIPI_DSI_DCS_ID_WRITE_MEMORY_START;
+
+    while (row < p_rect->height)
+    {
+        /* Only one packet is in flight, so the buffer that was sent two packets ago is free. */
+        uint8_t * p_packet = &p_cfg->p_packet_buffer[p_ctrl->packet_index * p_cfg->packet_size];
+        uint32_t  fill     = 1U;
+
+        p_packet[0] = dcs;
+        while ((fill <= payload) && (row < p_rect->height))
+        {
+            uint32_t bytes = row_bytes - column;
+            bytes = (bytes < (payload + 1U - fill)) ? bytes : (payload + 1U - fill);
+
+            memcpy(&p_packet[fill], &p_row[column], bytes);
+            fill   += bytes;
+            column += bytes;
+            if (column == row_bytes)
+            {
+                column = 0U;
+                row++;
+                p_row += p_cfg->hstride;
+            }
+        }
+
+        err = rm_display_dirty_dcs_write(p_ctrl, p_packet, fill);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_ctrl->packet_index ^= 1U;
+        dcs                   = MIPI_DSI_DCS_ID_WRITE_MEMORY_CONTINUE;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Copy a contiguous span of a frame buffer. The span is copied with the transfer instance in chunks of the largest
+ * normal mode transfer, using the widest transfer size allowed by the alignment of the span. The CPU copies the
+ * span when no transfer instance is configured.
+ *
+ * @param[in]  p_ctrl                  Pointer to the tracker control block.
+ * @param[in]  p_dest                  Destination of the span.
+ * @param[in]  p_src                   Source of the span.
+ * @param[in]  bytes                   Size of the span in bytes.
+ *
+ * @return Return code of the first transfer call that failed, or FSP_SUCCESS.
+ **********************************************************************************************************************/
+static fsp_err_t rm_display_dirty_copy (display_dirty_instance_ctrl_t * const p_ctrl,
+                                        uint8_t * const                       p_dest,
+                                        uint8_t const * const                 p_src,
+                                        uint32_t                              bytes)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer;
+
+    if (NULL == p_transfer)
+    {
+        memcpy(p_dest, p_src, bytes);
+
+        return FSP_SUCCESS;
+    }
+
+    uint32_t        alignment = (uint32_t) p_dest | (uint32_t) p_src | bytes;
+    transfer_size_t size      = TRANSFER_SIZE_1_BYTE;
+    if (0U == (alignment & 3U))
+    {
+        size = TRANSFER_SIZE_4_BYTE;
+    }
+    else if (0U == (alignment & 1U))
+    {
+        size = TRANSFER_SIZE_2_BYTE;
+    }
+
+    transfer_info_t * p_info = &p_ctrl->transfer_info;
+    p_info->transfer_settings_word                  = 0U;
+    p_info->transfer_settings_word_b.mode           = TRANSFER_MODE_NORMAL;
+    p_info->transfer_settings_word_b.size           = size;
+    p_info->transfer_settings_word_b.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->transfer_settings_word_b.irq            = TRANSFER_IRQ_END;
+    p_info->num_blocks = 0U;
+
+    uint32_t remaining = bytes >> size;
+    uint32_t offset    = 0U;
+    while (remaining > 0U)
+    {
+        uint32_t count = (remaining < p_ctrl->transfer_max) ? remaining : p_ctrl->transfer_max;
+
+        p_info->p_src  = &p_src[offset];
+        p_info->p_dest = &p_dest[offset];
+        p_info->length = (uint16_t) count;
+
+        fsp_err_t err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        err = p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        transfer_properties_t properties;
+        do
+        {
+            err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        } while (0U != properties.transfer_length_remaining);
+
+        remaining -= count;
+        offset    += count << size;
+    }
+
+    return FSP_SUCCESS;
+}
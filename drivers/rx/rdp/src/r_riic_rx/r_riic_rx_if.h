@@ -68,6 +68,7 @@
  *         : 01.08.2024 2.91     Fixed issues related to EEI and TEI interrupt priority levels for RX651 in MDF file.
  *         : 08.08.2024 3.00     Added RX260, RX261 support.
  *         : 15.03.2025 3.01     Updated disclaimer.
+ *         : 19.10.2026 3.10     Added R_RIIC_MasterTransactionList function.
  **********************************************************************************************************************/
 /* Guards against multiple inclusion */
 #ifndef RIIC_IF_H
@@ -90,7 +91,7 @@ R_BSP_PRAGMA_UNPACK
 
 /* Version Number of API. */
     #define RIIC_VERSION_MAJOR      (3)
-    #define RIIC_VERSION_MINOR      (01)
+    #define RIIC_VERSION_MINOR      (10)
 
 /*----------------------------------------------------------------------------*/
 /*   Defines the argument of the R_RIIC_Control function.                     */
@@ -161,6 +162,19 @@ typedef volatile struct
     uint8_t            * p_slv_adr; /* Pointer for Slave address buffer */
 } riic_info_t;
 
+/* ---- Transaction list entry structure type. ---- */
+/* A write transaction sets cnt2nd to 0. A read transaction sets cnt2nd to the number of bytes to read;   */
+/* when cnt1st is not 0, the 1st data is transmitted first and the read follows after a restart condition. */
+typedef struct
+{
+    riic_ch_dev_status_t dev_sts; /* Device status flag of this transaction */
+    uint8_t            * p_slv_adr; /* Pointer for Slave address buffer */
+    uint8_t            * p_data1st; /* Pointer for 1st Data buffer (transmit data) */
+    uint32_t             cnt1st; /* 1st Data Counter */
+    uint8_t            * p_data2nd; /* Pointer for 2nd Data buffer (receive data) */
+    uint32_t             cnt2nd; /* 2nd Data Counter */
+} riic_transaction_t;
+
 /*----------------------------------------------------------------------------*/
 /*   Define riic status structure type.                                       */
 /*----------------------------------------------------------------------------*/
@@ -227,6 +241,16 @@ riic_return_t R_RIIC_MasterSend (riic_info_t *);
  *****************************************************************************/
 riic_return_t R_RIIC_MasterReceive (riic_info_t *);
 
+/******************************************************************************
+ * Function Name: R_RIIC_MasterTransactionList
+ * Description  : .
+ * Arguments    : riic_info_t
+ *              : riic_transaction_t
+ *              : num
+ * Return Value : .
+ *****************************************************************************/
+riic_return_t R_RIIC_MasterTransactionList (riic_info_t *, riic_transaction_t *, uint16_t num);
+
 /******************************************************************************
  * Function Name: R_RIIC_SlaveTransfer
  * Description  : .
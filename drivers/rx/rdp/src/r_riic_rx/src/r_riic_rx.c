@@ -100,6 +100,10 @@ static riic_info_t * priic_info_s[MAX_RIIC_CH_NUM]; /* IIC driver information */
 static riic_api_event_t riic_api_event[MAX_RIIC_CH_NUM]; /* Event flag */
 static riic_api_info_t riic_api_info[MAX_RIIC_CH_NUM]; /* Internal status management */
 
+static riic_transaction_t * priic_list[MAX_RIIC_CH_NUM]; /* Transaction list on communication */
+static uint16_t riic_list_num[MAX_RIIC_CH_NUM]; /* Number of transactions in the list */
+static uint16_t riic_list_idx[MAX_RIIC_CH_NUM]; /* Index of the transaction on communication */
+
 /*----------------------------------------------------------------------------*/
 /*   Main processing of RIIC Driver API functions                             */
 /*----------------------------------------------------------------------------*/
@@ -107,6 +111,8 @@ static riic_return_t riic_open (riic_info_t *);
 static riic_return_t riic_master_send (riic_info_t *);
 static riic_return_t riic_master_receive (riic_info_t *);
 static riic_return_t riic_master_send_receive (riic_info_t *);
+static riic_return_t riic_master_transaction_start (riic_info_t *);
+static bool riic_master_transaction_end (riic_info_t *);
 static riic_return_t riic_slave_transfer (riic_info_t *);
 static void riic_getstatus (riic_info_t *, riic_mcu_status_t *);
 static riic_return_t riic_control (riic_info_t *, uint8_t ctrl_ptn);
@@ -161,6 +167,8 @@ static void riic_reset_clear (riic_info_t *);
 static void riic_reset_set (riic_info_t *);
 static void riic_all_reset (riic_info_t *);
 static void riic_clear_ir_flag (riic_info_t *);
+static bool riic_list_send_data (uint8_t ch_no);
+static bool riic_list_receive_data (uint8_t ch_no);
 
 riic_return_t riic_bps_calc (riic_info_t *, uint16_t kbps);
 
@@ -757,6 +765,205 @@ static riic_return_t riic_master_send_receive(riic_info_t * p_riic_info)
     return ret;
 } /* End of function riic_master_send_receive() */
 
+/**********************************************************************************************************************
+ * Function Name: R_RIIC_MasterTransactionList
+ *****************************************************************************************************************/ /**
+ * @brief Starts a list of master transactions. Operates batched processing until the last transaction of the list 
+ *        ends.
+ * @param[in,out] *p_riic_info
+ *             This is the pointer to the I2C communication information structure. The channel number and the 
+ *             callback function are used. The slave address and data members are overwritten by the driver for 
+ *             each transaction of the list.
+ * @param[in,out] *p_list
+ *             This is the pointer to the transaction list. The device status flag of each entry is updated when 
+ *             the transaction ends.
+ * @param[in] num
+ *             Number of transactions in the list.
+ * @retval    RIIC_SUCCESS             Processing completed successfully
+ * @retval    RIIC_ERR_INVALID_CHAN    The channel is nonexistent
+ * @retval    RIIC_ERR_INVALID_ARG     The parameter is invalid
+ * @retval    RIIC_ERR_NO_INIT         Uninitialized state
+ * @retval    RIIC_ERR_BUS_BUSY        The bus state is busy
+ * @retval    RIIC_ERR_AL              Arbitration-lost error occurred
+ * @retval    RIIC_ERR_TMO             Timeout is detected
+ * @retval    RIIC_ERR_OTHER           The event occurred is invalid in the current state
+ * @details   Executes the transactions in the list one after another. A transaction with cnt2nd set to 0 is 
+ *            performed as a master transmission. Other transactions are performed as a master reception; when 
+ *            cnt1st is not 0, the 1st data is transmitted first and the reception follows after a restart 
+ *            condition. Each transaction ends with a stop condition. \n
+ *            The next transaction is started from the interrupt which detects the stop condition of the previous 
+ *            one, and the callback function is called only once, after the last transaction ends or when the list 
+ *            is stopped. The list continues when a transaction ends with RIIC_NACK and is stopped when a transaction 
+ *            ends with any other state than RIIC_FINISH. \n
+ *            While the list is executed, the data bytes of each transaction are transferred directly in the TEI 
+ *            and RXI interrupts. The internal state machine runs only for the start condition, the slave address, 
+ *            the restart condition, the last three bytes of a reception and the stop condition. \n
+ *            The result of each transaction is stored in the dev_sts member of the list entry. The entries which 
+ *            are not executed are left in RIIC_IDLE.
+ * @note      The list and the data buffers must not be modified until the callback function is called.
+ */
+riic_return_t R_RIIC_MasterTransactionList(riic_info_t * p_riic_info, riic_transaction_t * p_list, uint16_t num)
+{
+    riic_return_t ret;
+    uint16_t i;
+
+    /* ---- CHECK ARGUMENTS ---- */
+#if (1U == RIIC_CFG_PARAM_CHECKING_ENABLE)
+    if ((((NULL == p_riic_info) || (NULL == p_list)) || (0 == num)) || (NULL == p_riic_info->callbackfunc))
+    {
+        return RIIC_ERR_INVALID_ARG;
+    }
+
+    /* WAIT_LOOP */
+    for (i = 0; i < num; i++)
+    {
+        if ((((NULL == p_list[i].p_slv_adr) || ((uint8_t *) FIT_NO_PTR == p_list[i].p_slv_adr))
+                || ((0 != p_list[i].cnt1st) && (NULL == p_list[i].p_data1st)))
+                || ((0 != p_list[i].cnt2nd) && (NULL == p_list[i].p_data2nd)))
+        {
+            return RIIC_ERR_INVALID_ARG;
+        }
+    }
+
+    /* ---- CHECK CHANNEL ---- */
+    if (false == riic_mcu_check_channel(p_riic_info->ch_no))
+    {
+        return RIIC_ERR_INVALID_CHAN;
+    }
+
+#endif
+
+    /* Checks the channel status before the list of the channel is replaced. */
+    ret = riic_check_chstatus_start(p_riic_info);
+
+    if (RIIC_SUCCESS != ret)
+    {
+        return ret;
+    }
+
+    /* Initializes the device status flag of each transaction. */
+    /* WAIT_LOOP */
+    for (i = 0; i < num; i++)
+    {
+        p_list[i].dev_sts = RIIC_IDLE;
+    }
+
+    /* Sets the transaction list. */
+    priic_list[p_riic_info->ch_no]    = p_list;
+    riic_list_num[p_riic_info->ch_no] = num;
+    riic_list_idx[p_riic_info->ch_no] = 0;
+
+    /* Starts the first transaction. */
+    ret = riic_master_transaction_start(p_riic_info);
+
+    if (RIIC_SUCCESS != ret)
+    {
+        /* Clears the transaction list. */
+        priic_list[p_riic_info->ch_no] = NULL;
+    }
+
+    return ret;
+} /* End of function R_RIIC_MasterTransactionList() */
+
+/***********************************************************************************************************************
+ * Function Name: riic_master_transaction_start
+ * Description  : sub function of R_RIIC_MasterTransactionList().
+ *              : Sets the transaction on the list index to IIC Information. Starts the master transmission or
+ *              : the master reception.
+ * Arguments    : riic_info_t * p_riic_info      ; IIC Information
+ * Return Value : Refer to riic_master_send(), riic_master_receive() and riic_master_send_receive().
+ **********************************************************************************************************************/
+static riic_return_t riic_master_transaction_start(riic_info_t * p_riic_info)
+{
+    riic_return_t ret;
+    riic_transaction_t * p_trans = &priic_list[p_riic_info->ch_no][riic_list_idx[p_riic_info->ch_no]];
+
+    p_riic_info->p_slv_adr = p_trans->p_slv_adr;
+
+    if (0 == p_trans->cnt2nd)
+    {
+        /* Master transmission */
+        /* The transmit data is set as the 2nd data (pattern 2 of master write), or no data is set when there is  */
+        /* nothing to transmit (pattern 3 of master write).                                                        */
+        p_riic_info->p_data1st = (uint8_t *) FIT_NO_PTR;
+        p_riic_info->cnt1st    = 0;
+        p_riic_info->cnt2nd    = p_trans->cnt1st;
+
+        if (0 != p_trans->cnt1st)
+        {
+            p_riic_info->p_data2nd = p_trans->p_data1st;
+        }
+        else
+        {
+            p_riic_info->p_data2nd = (uint8_t *) FIT_NO_PTR;
+        }
+
+        ret = riic_master_send(p_riic_info);
+    }
+    else if (0 == p_trans->cnt1st)
+    {
+        /* Master reception */
+        p_riic_info->p_data1st = (uint8_t *) FIT_NO_PTR;
+        p_riic_info->cnt1st    = 0;
+        p_riic_info->p_data2nd = p_trans->p_data2nd;
+        p_riic_info->cnt2nd    = p_trans->cnt2nd;
+        ret = riic_master_receive(p_riic_info);
+    }
+    else
+    {
+        /* Master transmission and reception */
+        p_riic_info->p_data1st = p_trans->p_data1st;
+        p_riic_info->cnt1st    = p_trans->cnt1st;
+        p_riic_info->p_data2nd = p_trans->p_data2nd;
+        p_riic_info->cnt2nd    = p_trans->cnt2nd;
+        ret = riic_master_send_receive(p_riic_info);
+    }
+
+    return ret;
+} /* End of function riic_master_transaction_start() */
+
+/***********************************************************************************************************************
+ * Function Name: riic_master_transaction_end
+ * Description  : Transaction End Processing.
+ *              : Stores the device status to the transaction on the list index and advances the list index.
+ *              : Clears the transaction list when the list is finished or stopped.
+ * Arguments    : riic_info_t * p_riic_info      ; IIC Information
+ * Return Value : RIIC_TRUE                      ; The next transaction of the list is to be started
+ *              : RIIC_FALSE                     ; No transaction list, or the list is finished or stopped
+ **********************************************************************************************************************/
+static bool riic_master_transaction_end(riic_info_t * p_riic_info)
+{
+    uint8_t ch_no = p_riic_info->ch_no;
+    riic_ch_dev_status_t dev_sts;
+    volatile uint8_t * const picsr2_reg = RIIC_ICSR2_ADR(ch_no);
+    volatile uint8_t         uctmp      = 0x00;
+
+    if (NULL == priic_list[ch_no])
+    {
+        return RIIC_FALSE;
+    }
+
+    /* Stores the device status of the transaction. */
+    dev_sts = priic_info_m[ch_no]->dev_sts;
+    priic_list[ch_no][riic_list_idx[ch_no]].dev_sts = dev_sts;
+    riic_list_idx[ch_no]++;
+
+    if ((riic_list_idx[ch_no] < riic_list_num[ch_no]) && ((RIIC_FINISH == dev_sts) || (RIIC_NACK == dev_sts)))
+    {
+        /* Clears ICSR2.NACKF. The RIIC does not transmit while it is set, and the next transaction would end */
+        /* with RIIC_NACK.                                                                                      */
+        (*picsr2_reg) &= RIIC_ICSR2_NACKF_CLR;
+        uctmp          = *picsr2_reg;
+
+        return RIIC_TRUE;
+    }
+
+    /* Clears the transaction list. */
+    priic_list[ch_no] = NULL;
+
+    return RIIC_FALSE;
+} /* End of function riic_master_transaction_end() */
+
 /**********************************************************************************************************************
  * Function Name: R_RIIC_SlaveTransfer
  *****************************************************************************************************************/ /**
@@ -1575,6 +1782,9 @@ static void riic_close(riic_info_t * p_riic_info)
     /* Updates the channel status. */
     riic_set_ch_status(p_riic_info, RIIC_NO_INIT);
 
+    /* Clears the transaction list. */
+    priic_list[p_riic_info->ch_no] = NULL;
+
     /* Disables IIC. */
     riic_disable(p_riic_info);
 
@@ -1652,6 +1862,7 @@ static riic_return_t riic_advance(riic_info_t * p_riic_info)
     volatile uint8_t * const picsr2_reg = RIIC_ICSR2_ADR(p_riic_info->ch_no);
     volatile uint8_t * const picier_reg = RIIC_ICIER_ADR(p_riic_info->ch_no);
     riic_return_t ret;
+    bool list_next = RIIC_FALSE;
 
     /* Checks the channel status. */
     ret = riic_check_chstatus_advance(p_riic_info);
@@ -1681,6 +1892,10 @@ static riic_return_t riic_advance(riic_info_t * p_riic_info)
                             || (RIIC_MODE_M_SEND_RECEIVE == riic_api_info[p_riic_info->ch_no].B_Mode))
                     {
                         riic_set_ch_status(priic_info_m[p_riic_info->ch_no], RIIC_TMO);
+
+                        /* Stops the transaction list. */
+                        riic_master_transaction_end(p_riic_info);
+
                         if (NULL != g_riic_callbackfunc_m[p_riic_info->ch_no])
                         {
                             g_riic_callbackfunc_m[p_riic_info->ch_no]();
@@ -1728,6 +1943,9 @@ static riic_return_t riic_advance(riic_info_t * p_riic_info)
                         riic_set_ch_status(p_riic_info, RIIC_FINISH);
                     }
 
+                    /* Advances the transaction list. */
+                    list_next = riic_master_transaction_end(p_riic_info);
+
                     /* Checks the callback function. */
                     if ((((((RIIC_MODE_M_SEND == riic_api_info[p_riic_info->ch_no].N_Mode)
                             || (RIIC_MODE_M_SEND == riic_api_info[p_riic_info->ch_no].B_Mode))
@@ -1736,7 +1954,8 @@ static riic_return_t riic_advance(riic_info_t * p_riic_info)
                             || (RIIC_MODE_M_SEND_RECEIVE == riic_api_info[p_riic_info->ch_no].N_Mode))
                             || (RIIC_MODE_M_SEND_RECEIVE == riic_api_info[p_riic_info->ch_no].B_Mode))
                     {
-                        if (NULL != g_riic_callbackfunc_m[p_riic_info->ch_no])
+                        /* The callback function is called after the last transaction of the list. */
+                        if ((RIIC_FALSE == list_next) && (NULL != g_riic_callbackfunc_m[p_riic_info->ch_no]))
                         {
                             g_riic_callbackfunc_m[p_riic_info->ch_no]();
                         }
@@ -1798,6 +2017,22 @@ static riic_return_t riic_advance(riic_info_t * p_riic_info)
                             /* Do Nothing */
                         }
                     }
+
+                    /* Starts the next transaction of the list. */
+                    if (RIIC_TRUE == list_next)
+                    {
+                        if (RIIC_SUCCESS != riic_master_transaction_start(priic_info_m[p_riic_info->ch_no]))
+                        {
+                            /* Stops the transaction list. */
+                            priic_list[p_riic_info->ch_no][riic_list_idx[p_riic_info->ch_no]].dev_sts = RIIC_ERROR;
+                            priic_list[p_riic_info->ch_no] = NULL;
+
+                            if (NULL != g_riic_callbackfunc_m[p_riic_info->ch_no])
+                            {
+                                g_riic_callbackfunc_m[p_riic_info->ch_no]();
+                            }
+                        }
+                    }
                 }
                 break;
 
@@ -3983,6 +4218,84 @@ riic_return_t riic_bps_calc(riic_info_t * p_riic_info, uint16_t kbps)
 
 } /* End of function riic_bps_calc() */
 
+/***********************************************************************************************************************
+ * Function Name: riic_list_send_data
+ * Description  : Transaction List Data Sending Processing.
+ *                Transmits the data without advancing the state machine when the transaction list is on
+ *                communication and data to transmit remains. A write transaction transmits its data as the 2nd data
+ *                (pattern 2 of master write), a write-read transaction as the 1st data.
+ * Arguments    : uint8_t ch_no                  ; Channel No.
+ * Return Value : RIIC_TRUE                      ; The data is transmitted
+ *              : RIIC_FALSE                     ; The state machine has to be advanced
+ **********************************************************************************************************************/
+static bool riic_list_send_data(uint8_t ch_no)
+{
+    riic_info_t * p_riic_info = priic_info_m[ch_no];
+
+    if (((NULL == priic_list[ch_no]) || (RIIC_STS_SEND_DATA_WAIT != riic_api_info[ch_no].N_status))
+            || (RIIC_COMMUNICATION != g_riic_ChStatus[ch_no]))
+    {
+        return RIIC_FALSE;
+    }
+
+    if ((RIIC_MODE_M_SEND_RECEIVE == riic_api_info[ch_no].N_Mode) && (0x00000000 != p_riic_info->cnt1st))
+    {
+        /* Transmits a 1st data. */
+        riic_set_sending_data(p_riic_info, p_riic_info->p_data1st);
+        p_riic_info->cnt1st--;
+        p_riic_info->p_data1st++;
+
+        return RIIC_TRUE;
+    }
+
+    /* A write transaction is started as pattern 2 of master write. */
+    if ((RIIC_MODE_M_SEND == riic_api_info[ch_no].N_Mode) && (0x00000000 != p_riic_info->cnt2nd))
+    {
+        /* Transmits a 2nd data. */
+        riic_set_sending_data(p_riic_info, p_riic_info->p_data2nd);
+        p_riic_info->cnt2nd--;
+        p_riic_info->p_data2nd++;
+
+        return RIIC_TRUE;
+    }
+
+    return RIIC_FALSE;
+} /* End of function riic_list_send_data() */
+
+/***********************************************************************************************************************
+ * Function Name: riic_list_receive_data
+ * Description  : Transaction List Data Receiving Processing.
+ *                Stores the received data without advancing the state machine when the transaction list is on
+ *                communication and more than three bytes remain to be received.
+ * Arguments    : uint8_t ch_no                  ; Channel No.
+ * Return Value : RIIC_TRUE                      ; The data is stored
+ *              : RIIC_FALSE                     ; The state machine has to be advanced
+ **********************************************************************************************************************/
+static bool riic_list_receive_data(uint8_t ch_no)
+{
+    riic_info_t * p_riic_info = priic_info_m[ch_no];
+
+    if (((NULL == priic_list[ch_no]) || (RIIC_STS_RECEIVE_DATA_WAIT != riic_api_info[ch_no].N_status))
+            || (RIIC_COMMUNICATION != g_riic_ChStatus[ch_no]))
+    {
+        return RIIC_FALSE;
+    }
+
+    /* The last three bytes are received by riic_read_data_receiving() to control WAIT, ACKBT and stop. */
+    if (((RIIC_MODE_M_RECEIVE == riic_api_info[ch_no].N_Mode)
+            || (RIIC_MODE_M_SEND_RECEIVE == riic_api_info[ch_no].N_Mode)) && (0x00000003 < p_riic_info->cnt2nd))
+    {
+        /* Stores the received data. */
+        *p_riic_info->p_data2nd = riic_get_receiving_data(p_riic_info);
+        p_riic_info->cnt2nd--;
+        p_riic_info->p_data2nd++;
+
+        return RIIC_TRUE;
+    }
+
+    return RIIC_FALSE;
+} /* End of function riic_list_receive_data() */
+
 #if (RIIC_CFG_CH0_INCLUDED == 1U)
 /***********************************************************************************************************************
  * Function Name: riic0_eei_sub
@@ -4228,6 +4541,12 @@ void riic0_rxi_sub(void)
     riic_timeout_counter_clear(0);
     #endif
 
+    /* Stores the received data of the transaction list. */
+    if (RIIC_TRUE == riic_list_receive_data(0))
+    {
+        return;
+    }
+
     if (RIIC_STS_AL == riic_api_info[0].N_status)
     {
         /* Sets the internal status. */
@@ -4295,6 +4614,12 @@ void riic0_tei_sub(void)
         /* Do Nothing */
     }
 
+    /* Transmits the data of the transaction list. */
+    if (RIIC_TRUE == riic_list_send_data(0))
+    {
+        return;
+    }
+
     /* Sets event. */
     switch (riic_api_info[0].N_status)
     {
@@ -4570,6 +4895,12 @@ void riic1_rxi_sub (void)
     riic_timeout_counter_clear(1);
     #endif
 
+    /* Stores the received data of the transaction list. */
+    if (RIIC_TRUE == riic_list_receive_data(1))
+    {
+        return;
+    }
+
     if (RIIC_STS_AL == riic_api_info[1].N_status)
     {
         /* Sets the internal status. */
@@ -4638,6 +4969,12 @@ void riic1_tei_sub (void)
         /* Do Nothing */
     }
 
+    /* Transmits the data of the transaction list. */
+    if (RIIC_TRUE == riic_list_send_data(1))
+    {
+        return;
+    }
+
     /* Sets event. */
     switch (riic_api_info[1].N_status)
     {
@@ -4913,6 +5250,12 @@ void riic2_rxi_sub (void)
     riic_timeout_counter_clear(2);
     #endif
 
+    /* Stores the received data of the transaction list. */
+    if (RIIC_TRUE == riic_list_receive_data(2))
+    {
+        return;
+    }
+
     if (RIIC_STS_AL == riic_api_info[2].N_status)
     {
         /* Sets the internal status. */
@@ -4981,6 +5324,12 @@ void riic2_tei_sub (void)
         /* Do Nothing */
     }
 
+    /* Transmits the data of the transaction list. */
+    if (RIIC_TRUE == riic_list_send_data(2))
+    {
+        return;
+    }
+
     /* Sets event. */
     switch (riic_api_info[2].N_status)
     {
@@ -17,6 +17,7 @@
  * under the License.
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <DA1469xAB.h>
@@ -27,6 +28,9 @@
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
 
+/* Data committed to CMAC but not signalled yet */
+static bool g_mbox_signal_pending;
+
 static struct cmac_shm_mbox *
 mbox_src_get(uint16_t *size)
 {
@@ -96,67 +100,160 @@ cmac_mbox_read(void *data, uint16_t len)
 }
 
 int
-cmac_mbox_write(const void *data, uint16_t len)
+cmac_mbox_peek(struct cmac_mbox_span *span)
+{
+    volatile struct cmac_shm_mbox *mbox;
+    uint16_t mbox_size;
+    uint8_t *mbox_buf;
+    uint16_t rd_off;
+    uint16_t wr_off;
+
+    mbox = mbox_src_get(&mbox_size);
+    /* no need for volatile on data buffer */
+    mbox_buf = (void *)mbox->data;
+
+    rd_off = mbox->rd_off;
+    wr_off = mbox->wr_off;
+
+    span->ptr[0] = &mbox_buf[rd_off];
+    span->ptr[1] = mbox_buf;
+
+    if (rd_off <= wr_off) {
+        span->len[0] = wr_off - rd_off;
+        span->len[1] = 0;
+    } else {
+        span->len[0] = mbox_size - rd_off;
+        span->len[1] = wr_off;
+    }
+
+    return span->len[0] + span->len[1];
+}
+
+void
+cmac_mbox_consume(uint16_t len)
+{
+    volatile struct cmac_shm_mbox *mbox;
+    uint16_t mbox_size;
+    uint32_t rd_off;
+
+    mbox = mbox_src_get(&mbox_size);
+
+    rd_off = mbox->rd_off + len;
+
+    /* Data must be parsed before CMAC can overwrite it */
+    __DMB();
+
+    mbox->rd_off = rd_off >= mbox_size ? rd_off - mbox_size : rd_off;
+}
+
+int
+cmac_mbox_write_reserve(struct cmac_mbox_span *span, uint16_t len)
 {
     volatile struct cmac_shm_mbox *mbox;
     uint16_t mbox_size;
     uint8_t *mbox_buf;
     uint16_t rd_off;
     uint16_t wr_off;
-    uint16_t max_wr;
-    uint16_t chunk;
 
     mbox = mbox_dst_get(&mbox_size);
     /* no need for volatile on data buffer */
     mbox_buf = (void *)mbox->data;
 
-    while (len) {
-        rd_off = mbox->rd_off;
-        wr_off = mbox->wr_off;
+    rd_off = mbox->rd_off;
+    wr_off = mbox->wr_off;
+
+    span->ptr[0] = &mbox_buf[wr_off];
+    span->ptr[1] = mbox_buf;
+    span->len[1] = 0;
 
+    /*
+     * Calculate maximum length to write, i.e. up to end of buffer or stop
+     * before rd_off to be able to detect full queue.
+     */
+    if (rd_off > wr_off) {
         /*
-         * Calculate maximum length to write, i.e. up to end of buffer or stop
-         * before rd_off to be able to detect full queue.
+         * |0|1|2|3|4|5|6|7|
+         * | | | |W| | |R| |
+         *        `---^
          */
-        if (rd_off > wr_off) {
-            /*
-             * |0|1|2|3|4|5|6|7|
-             * | | | |W| | |R| |
-             *        `---^
-             */
-            max_wr = rd_off - wr_off - 1;
-        } else if (rd_off == 0) {
-            /*
-             * |0|1|2|3|4|5|6|7|
-             * |R| | |W| | | | |
-             *        `-------^
-             */
-            max_wr = mbox_size - wr_off - 1;
-        } else {
-            /*
-             * |0|1|2|3|4|5|6|7|
-             * | |R| |W| | | | |
-             *        `---------^
-             */
-            max_wr = mbox_size - wr_off;
-        }
+        span->len[0] = rd_off - wr_off - 1;
+    } else if (rd_off == 0) {
+        /*
+         * |0|1|2|3|4|5|6|7|
+         * |R| | |W| | | | |
+         *        `-------^
+         */
+        span->len[0] = mbox_size - wr_off - 1;
+    } else {
+        /*
+         * |0|1|2|3|4|5|6|7|
+         * | |R| |W| | | | |
+         *  ^     `---------^
+         *  `-^
+         */
+        span->len[0] = mbox_size - wr_off;
+        span->len[1] = rd_off - 1;
+    }
+
+    span->len[0] = min(span->len[0], len);
+    span->len[1] = min(span->len[1], len - span->len[0]);
+
+    return span->len[0] + span->len[1];
+}
+
+void
+cmac_mbox_write_commit(uint16_t len)
+{
+    volatile struct cmac_shm_mbox *mbox;
+    uint16_t mbox_size;
+    uint32_t wr_off;
+
+    mbox = mbox_dst_get(&mbox_size);
+
+    wr_off = mbox->wr_off + len;
 
-        chunk = min(len, max_wr);
+    /* Data must be visible to CMAC before the write offset */
+    __DMB();
+
+    mbox->wr_off = wr_off >= mbox_size ? wr_off - mbox_size : wr_off;
+
+    g_mbox_signal_pending = true;
+}
+
+void
+cmac_mbox_write_flush(void)
+{
+    if (g_mbox_signal_pending) {
+        g_mbox_signal_pending = false;
+        cmac_signal();
+    }
+}
+
+int
+cmac_mbox_write(const void *data, uint16_t len)
+{
+    struct cmac_mbox_span span;
+    uint16_t chunk;
+
+    while (len) {
+        chunk = cmac_mbox_write_reserve(&span, len);
 
         if (chunk == 0) {
+            /* Queue is full, make sure CMAC knows there is data to drain */
+            cmac_mbox_write_flush();
             continue;
         }
 
-        memcpy(&mbox_buf[wr_off], data, chunk);
+        memcpy(span.ptr[0], data, span.len[0]);
+        memcpy(span.ptr[1], (const uint8_t *)data + span.len[0], span.len[1]);
 
-        wr_off += chunk;
-        mbox->wr_off = wr_off == mbox_size ? 0 : wr_off;
-
-	    cmac_signal();
+        cmac_mbox_write_commit(chunk);
 
         len -= chunk;
-        data = (uint8_t *)data + chunk;
+        data = (const uint8_t *)data + chunk;
     }
 
+    cmac_mbox_write_flush();
+
     return 0;
 }
@@ -26,10 +26,37 @@
 extern "C" {
 #endif
 
+/*
+ * Contiguous areas of a mailbox. When the area wraps around the end of the
+ * ring, the second span starts at the beginning of the ring; otherwise its
+ * length is 0.
+ */
+struct cmac_mbox_span {
+    uint8_t *ptr[2];
+    uint16_t len[2];
+};
+
 int cmac_mbox_has_data(void);
 int cmac_mbox_read(void *data, uint16_t len);
 int cmac_mbox_write(const void *data, uint16_t len);
 
+/*
+ * Zero-copy access to the mailbox rings.
+ *
+ * cmac_mbox_peek() returns the data available from CMAC without copying it;
+ * cmac_mbox_consume() releases it once parsed.
+ *
+ * cmac_mbox_write_reserve() returns up to len bytes of free space in the ring
+ * to CMAC; cmac_mbox_write_commit() publishes the bytes filled in. Committed
+ * data is signalled to CMAC by cmac_mbox_write_flush(), so a burst of packets
+ * costs a single signal.
+ */
+int cmac_mbox_peek(struct cmac_mbox_span *span);
+void cmac_mbox_consume(uint16_t len);
+int cmac_mbox_write_reserve(struct cmac_mbox_span *span, uint16_t len);
+void cmac_mbox_write_commit(uint16_t len);
+void cmac_mbox_write_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
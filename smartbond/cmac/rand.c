@@ -18,11 +18,27 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 
 #include <DA1469xAB.h>
 #include <rand.h>
 #include <shm.h>
 
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/* Refill is requested below this many words; 0 requests it whenever not full */
+static uint16_t g_rand_low_water;
+static bool g_rand_starved;
+static bool g_rand_req_pending;
+static uint32_t g_rand_req_cycles;
+static struct cmac_rand_stats g_rand_stats;
+
 int
 cmac_rand_is_active(void)
 {
@@ -57,26 +73,137 @@ cmac_rand_get_next(void)
     return next;
 }
 
+int
+cmac_rand_level(void)
+{
+    int level;
+
+    level = g_cmac_shm.rand->cmr_in - g_cmac_shm.rand->cmr_out;
+    if (level < 0) {
+        level += g_cmac_shm.config->rand_size;
+    }
+    return level;
+}
+
+void
+cmac_rand_set_low_water(uint16_t num_words)
+{
+    g_rand_low_water = num_words;
+}
+
+bool
+cmac_rand_is_low(void)
+{
+    int level;
+
+    level = cmac_rand_level();
+
+    /* CMAC may already be waiting on an empty ring, so always ask for more */
+    if (level == 0 || g_rand_starved || !g_rand_low_water) {
+        return true;
+    }
+
+    return level < g_rand_low_water;
+}
+
+static void
+cmac_rand_cyccnt_enable(void)
+{
+    /* The cycle counter only runs with trace enabled */
+#ifdef DCB
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
 void
+cmac_rand_requested(void)
+{
+    /*
+     * An empty ring while CMAC is active means it may already be waiting for
+     * random numbers; count it once until the next fill.
+     */
+    if (cmac_rand_level() == 0 && !g_rand_starved && cmac_rand_is_active()) {
+        g_rand_starved = true;
+        g_rand_stats.starvations++;
+    }
+
+    /* Fill latency is measured from the first request after a fill */
+    if (!g_rand_req_pending) {
+        if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+            cmac_rand_cyccnt_enable();
+        }
+        g_rand_req_pending = true;
+        g_rand_req_cycles = DWT->CYCCNT;
+    }
+}
+
+void
+cmac_rand_get_stats(struct cmac_rand_stats *stats)
+{
+    *stats = g_rand_stats;
+}
+
+int
 cmac_rand_fill(uint32_t *buf, int num_words)
 {
-    int next;
+    struct cmac_shm_rand *shm_rand;
+    uint32_t cycles;
+    int rand_size;
+    int copied;
+    int chunk;
+    int in;
+    int out;
+
+    shm_rand = g_cmac_shm.rand;
+    rand_size = g_cmac_shm.config->rand_size;
+    in = shm_rand->cmr_in;
+    out = shm_rand->cmr_out;
+    copied = 0;
 
-    /* XXX: if words is 0, is it possible we could get into a state
-       where we are waiting for random numbers but M33 does not know it
-       has to fill any? */
-
-    /* NOTE: we already know the buffer is not full first time through */
-    next = g_cmac_shm.rand->cmr_in;
-    while (num_words) {
-        g_cmac_shm.rand->cmr_buf[next] = buf[0];
-        next = cmac_rand_get_next();
-        g_cmac_shm.rand->cmr_in = next;
-        next = cmac_rand_get_next();
-        if (next == g_cmac_shm.rand->cmr_out) {
+    /*
+     * Copy into at most two contiguous free spans, up to the end of the ring
+     * and then from its start. One slot is kept empty so that a full ring can
+     * be told apart from an empty one.
+     */
+    while (copied < num_words) {
+        if (out > in) {
+            chunk = out - in - 1;
+        } else {
+            chunk = rand_size - in - (out == 0 ? 1 : 0);
+        }
+        chunk = min(chunk, num_words - copied);
+        if (chunk <= 0) {
             break;
         }
-        --num_words;
-        ++buf;
+
+        memcpy(&shm_rand->cmr_buf[in], &buf[copied], chunk * sizeof(uint32_t));
+        copied += chunk;
+        in += chunk;
+        if (in == rand_size) {
+            in = 0;
+        }
     }
+
+    if (copied == 0) {
+        return 0;
+    }
+
+    /* Words must be visible to CMAC before the input index */
+    __DMB();
+    shm_rand->cmr_in = in;
+
+    g_rand_stats.fills++;
+    g_rand_stats.words += copied;
+    if (g_rand_req_pending) {
+        cycles = DWT->CYCCNT - g_rand_req_cycles;
+        g_rand_stats.fill_latency_last = cycles;
+        g_rand_stats.fill_latency_max = MAX(g_rand_stats.fill_latency_max, cycles);
+        g_rand_req_pending = false;
+    }
+    g_rand_starved = false;
+
+    return copied;
 }
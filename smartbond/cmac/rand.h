@@ -20,6 +20,7 @@
 #ifndef __IPC_CMAC_SHM_RAND_H_
 #define __IPC_CMAC_SHM_RAND_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -27,6 +28,21 @@ extern "C" {
 #endif
 
 typedef void (*cmac_rand_isr_cb_t)(uint8_t rnum);
+
+struct cmac_rand_stats {
+    /* Times CMAC was found waiting on an empty ring */
+    uint32_t starvations;
+    /* Calls to cmac_rand_fill() that added words, and words added */
+    uint32_t fills;
+    uint32_t words;
+    /*
+     * Cycles from a refill request to the matching fill. Measured with the
+     * DWT cycle counter, which the first request enables if needed.
+     */
+    uint32_t fill_latency_last;
+    uint32_t fill_latency_max;
+};
+
 void cmac_rand_start(void);
 void cmac_rand_stop(void);
 void cmac_rand_read(void);
@@ -35,7 +51,12 @@ void cmac_rand_chk_fill(void);
 int cmac_rand_get_next(void);
 int cmac_rand_is_active(void);
 int cmac_rand_is_full(void);
-void cmac_rand_fill(uint32_t *buf, int num_words);
+int cmac_rand_fill(uint32_t *buf, int num_words);
+int cmac_rand_level(void);
+void cmac_rand_set_low_water(uint16_t num_words);
+bool cmac_rand_is_low(void);
+void cmac_rand_requested(void);
+void cmac_rand_get_stats(struct cmac_rand_stats *stats);
 void cmac_rand_set_isr_cb(cmac_rand_isr_cb_t cb);
 
 void cmac_rand_put(uint32_t word);
@@ -43,7 +64,7 @@ void cmac_rand_put(uint32_t word);
 static inline bool
 cmac_rand_needs_data(void)
 {
-    return (cmac_rand_is_active() && !cmac_rand_is_full());
+    return (cmac_rand_is_active() && !cmac_rand_is_full() && cmac_rand_is_low());
 }
 
 #ifdef __cplusplus
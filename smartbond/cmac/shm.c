@@ -89,6 +89,7 @@ cmac_cmac2sys_isr(void)
     }
 
     if (cmac_rand_needs_data()) {
+        cmac_rand_requested();
         cmac_rng_req();
     }
 }
@@ -128,6 +128,18 @@
 /* Min. horizontal frame width, in pixels, required by the host controller */
 #define MIPI_DBI_SMARTBOND_MIN_ACTIVE_FRAME_WIDTH    4
 
+/* MIPI DCS commands used for partial updates */
+#define MIPI_DCS_SMARTBOND_SET_COLUMN_ADDRESS    0x2A
+#define MIPI_DCS_SMARTBOND_SET_PAGE_ADDRESS      0x2B
+#define MIPI_DCS_SMARTBOND_WRITE_MEMORY_START    0x2C
+
+/* Partial update in progress, if any */
+static struct {
+	const lcdc_smartbond_partial_update *update;
+	uint8_t next_region;
+	bool frame_end_irq_en;
+} lcdc_partial;
+
 /**
  * Write to DBIB configuration register
  *
@@ -366,6 +378,112 @@ da1469x_lcdc_te_set_status(bool enable, bool inversion)
 	}
 }
 
+/**
+ * Send the window of a region and trigger the transfer of its pixels
+ *
+ * @param update  Partial update the region belongs to
+ * @param region  Region to be sent. It should already be validated.
+ *
+ */
+static void
+lcdc_partial_region_send(const lcdc_smartbond_partial_update *update,
+			 const lcdc_smartbond_region *region)
+{
+	lcdc_smartbond_timing_cfg timing = { 0 };
+	lcdc_smartbond_layer_cfg layer;
+	uint16_t end_x = region->start_x + region->size_x - 1;
+	uint16_t end_y = region->start_y + region->size_y - 1;
+	uint8_t column[4] = { region->start_x >> 8, region->start_x & 0xFF,
+				end_x >> 8, end_x & 0xFF };
+	uint8_t page[4] = { region->start_y >> 8, region->start_y & 0xFF,
+				end_y >> 8, end_y & 0xFF };
+	uint8_t cmd;
+
+	cmd = MIPI_DCS_SMARTBOND_SET_COLUMN_ADDRESS;
+	da1469x_lcdc_send_cmd_data(true, &cmd, 1);
+	da1469x_lcdc_send_cmd_data(false, column, sizeof(column));
+
+	cmd = MIPI_DCS_SMARTBOND_SET_PAGE_ADDRESS;
+	da1469x_lcdc_send_cmd_data(true, &cmd, 1);
+	da1469x_lcdc_send_cmd_data(false, page, sizeof(page));
+
+	/* Shrink the active frame to the region. MIPI DBI ignores the porches. */
+	da1469x_lcdc_timings_configure(region->size_x, region->size_y, &timing);
+
+	LCDC_SMARTBOND_LAYER_CONFIG(&layer, region->frame_buf, 0, 0, region->size_x,
+				region->size_y, update->color_format, region->stride);
+	da1469x_lcdc_layer_configure(&layer);
+
+	cmd = MIPI_DCS_SMARTBOND_WRITE_MEMORY_START;
+	da1469x_lcdc_send_cmd_data(true, &cmd, 1);
+
+	/* Pixels follow the memory write command; the transfer waits for TE if it is enabled */
+	LCDC->LCDC_MODE_REG |= LCDC_LCDC_MODE_REG_LCDC_SFRAME_UPD_Msk;
+}
+
+int
+da1469x_lcdc_partial_update_start(const lcdc_smartbond_partial_update *update)
+{
+	unsigned int key;
+
+	if (!update->regions || !update->num_regions) {
+		return -EINVAL;
+	}
+
+	/* Validate all regions up front so that the interrupt path cannot fail */
+	for (int i = 0; i < update->num_regions; i++) {
+		const lcdc_smartbond_region *region = &update->regions[i];
+
+		if ((region->frame_buf & 0x3) || (region->stride & 0x3) ||
+			region->size_x < MIPI_DBI_SMARTBOND_MIN_ACTIVE_FRAME_WIDTH ||
+				!region->size_y) {
+			return -EINVAL;
+		}
+	}
+
+	key = DA1469X_IRQ_DISABLE();
+	if (lcdc_partial.update) {
+		DA1469X_IRQ_ENABLE(key);
+		return -EBUSY;
+	}
+	lcdc_partial.update = update;
+	lcdc_partial.next_region = 1;
+	lcdc_partial.frame_end_irq_en =
+		!!(LCDC->LCDC_INTERRUPT_REG & LCDC_LCDC_INTERRUPT_REG_LCDC_FRAME_END_IRQ_EN_Msk);
+	DA1469X_IRQ_ENABLE(key);
+
+	LCDC->LCDC_INTERRUPT_REG |= LCDC_LCDC_INTERRUPT_REG_LCDC_FRAME_END_IRQ_EN_Msk;
+	lcdc_partial_region_send(update, &update->regions[0]);
+
+	return 0;
+}
+
+bool
+da1469x_lcdc_partial_update_isr(void)
+{
+	const lcdc_smartbond_partial_update *update = lcdc_partial.update;
+
+	if (!update) {
+		return false;
+	}
+
+	if (lcdc_partial.next_region < update->num_regions) {
+		lcdc_partial_region_send(update, &update->regions[lcdc_partial.next_region++]);
+		return true;
+	}
+
+	if (!lcdc_partial.frame_end_irq_en) {
+		LCDC->LCDC_INTERRUPT_REG &= ~LCDC_LCDC_INTERRUPT_REG_LCDC_FRAME_END_IRQ_EN_Msk;
+	}
+	lcdc_partial.update = NULL;
+
+	if (update->cb) {
+		update->cb(update->user_data);
+	}
+
+	return true;
+}
+
 int
 da1469x_lcdc_mipi_dbi_interface_configure(lcdc_smartbond_mipi_dbi_cfg *mipi_dbi)
 {
@@ -128,6 +128,37 @@ typedef struct {
 	uint8_t alpha;
 } lcdc_smartbond_bgcolor_cfg;
 
+typedef struct {
+	/*
+	 * Address of the top-left pixel of the region. Should first be translated
+	 * to its physical address.
+	 */
+	uint32_t frame_buf;
+	/* X/Y coordinates of the top-left corner of the region on the panel */
+	uint16_t start_x;
+	uint16_t start_y;
+	/* X/Y resolution of the region in pixels */
+	uint16_t size_x;
+	uint16_t size_y;
+	/*
+	 * Line to line distance in bytes of the region in memory. This is the
+	 * frame stride for a window of a frame buffer, or the value returned by
+	 * da1469x_lcdc_stride_calculation() for a region stored on its own.
+	 */
+	int32_t stride;
+} lcdc_smartbond_region;
+
+typedef struct {
+	/* Regions sent back to back, in order */
+	const lcdc_smartbond_region *regions;
+	uint8_t num_regions;
+	/* Layer color format of all regions */
+	uint8_t color_format;
+	/* Called from the LCDC interrupt once the last region has been sent */
+	void (*cb)(void *user_data);
+	void *user_data;
+} lcdc_smartbond_partial_update;
+
 /*
  * Min. timing settings required by the timing generator. For the MIPI DBI
  * inferface all timing setting can be safely ignored.
@@ -228,6 +259,37 @@ da1469x_lcdc_timings_configure(uint16_t x_res, uint16_t y_res, lcdc_smartbond_ti
 void
 da1469x_lcdc_te_set_status(bool enable, bool inversion);
 
+/**
+ * Start a queued partial update (MIPI DBI Type-B and SPI panels)
+ *
+ * Each region is sent as a column and page address set followed by a memory
+ * write of the region pixels. The next region is programmed from the frame
+ * end interrupt of the previous one, so regions are sent back to back without
+ * involving the caller. If TE signaling is enabled, the transfer of every
+ * region waits for the TE signal of the panel.
+ *
+ * The update and its regions should remain valid until the callback is called.
+ * The caller is responsible for calling da1469x_lcdc_partial_update_isr() from
+ * the LCDC interrupt handler.
+ *
+ * @param update  Pointer to structure that contains the regions to be sent
+ *
+ * @return Zero for success, -EBUSY if a partial update is in progress or
+ *         -EINVAL if a region does not meet the LCDC requirements.
+ */
+int
+da1469x_lcdc_partial_update_start(const lcdc_smartbond_partial_update *update);
+
+/**
+ * Advance a queued partial update
+ *
+ * Should be called from the LCDC interrupt handler upon frame end.
+ *
+ * @return True if the frame end belonged to a partial update, false otherwise.
+ */
+bool
+da1469x_lcdc_partial_update_isr(void);
+
 /**
  * LCDC configure RGB interface
  *
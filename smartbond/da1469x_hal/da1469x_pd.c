@@ -24,6 +24,7 @@
 #include <DA1469xAB.h>
 #include <da1469x_config.h>
 #include <da1469x_pd.h>
+#include <da1469x_sleep.h>
 #include <da1469x_trimv.h>
 
 #define PD_COUNT          (sizeof(g_da1469x_pd_desc) / sizeof(g_da1469x_pd_desc[0]))
@@ -42,6 +43,8 @@ struct da1469x_pd_data {
     uint8_t refcnt;
     uint8_t trimv_count;
     uint32_t *trimv_words;
+    struct da1469x_latency_hist up_latency;
+    struct da1469x_latency_hist down_latency;
 };
 
 enum chip_variant {
@@ -247,12 +250,19 @@ da1469x_pd_get_ref_cnt(uint8_t pd)
     return pdd->refcnt;
 }
 
+static inline bool
+da1469x_pd_is_timed(uint8_t pd)
+{
+    return pd != MCU_PD_DOMAIN_TIM && g_da1469x_pd_data[MCU_PD_DOMAIN_TIM].refcnt;
+}
+
 static int
 da1469x_pd_acquire_internal(uint8_t pd, bool load)
 {
     struct da1469x_pd_data *pdd;
     uint32_t primask;
     uint32_t bitmask;
+    uint32_t start;
     int ret = 0;
 
     assert(pd < PD_COUNT);
@@ -264,12 +274,20 @@ da1469x_pd_acquire_internal(uint8_t pd, bool load)
     assert(pdd->refcnt < UINT8_MAX);
 
     if (pdd->refcnt++ == 0) {
+        /* The lp clock timer is in PD_TIM, it cannot time its own domain */
+        start = da1469x_pd_is_timed(pd) ? da1469x_lp_timer_get() : 0;
+
         bitmask = 1 << g_da1469x_pd_desc[pd].pmu_sleep_bit;
         CRG_TOP->PMU_CTRL_REG &= ~bitmask;
 
         bitmask = 1 << (g_da1469x_pd_desc[pd].stat_down_bit + 1);
         while ((CRG_TOP->SYS_STAT_REG & bitmask) == 0);
 
+        if (da1469x_pd_is_timed(pd)) {
+            da1469x_latency_hist_add(&pdd->up_latency,
+                                     da1469x_lp_timer_diff(start, da1469x_lp_timer_get()));
+        }
+
         if (load) {
             da1469x_pd_apply_trimv(pd);
             da1469x_pd_apply_preferred(pd);
@@ -301,6 +319,7 @@ da1469x_pd_release_internal(uint8_t pd, bool wait)
     struct da1469x_pd_data *pdd;
     uint32_t primask;
     uint32_t bitmask;
+    uint32_t start;
     int ret = 0;
 
     assert(pd < PD_COUNT);
@@ -316,8 +335,15 @@ da1469x_pd_release_internal(uint8_t pd, bool wait)
         CRG_TOP->PMU_CTRL_REG |= bitmask;
 
         if (wait) {
+            start = da1469x_pd_is_timed(pd) ? da1469x_lp_timer_get() : 0;
+
             bitmask = 1 << g_da1469x_pd_desc[pd].stat_down_bit;
             while ((CRG_TOP->SYS_STAT_REG & bitmask) == 0);
+
+            if (da1469x_pd_is_timed(pd)) {
+                da1469x_latency_hist_add(&pdd->down_latency,
+                                         da1469x_lp_timer_diff(start, da1469x_lp_timer_get()));
+            }
         }
 
         ret = 1;
@@ -339,3 +365,17 @@ da1469x_pd_release_nowait(uint8_t pd)
 {
     return da1469x_pd_release_internal(pd, false);
 }
+
+void
+da1469x_pd_get_latency(uint8_t pd, struct da1469x_latency_hist *up,
+                       struct da1469x_latency_hist *down)
+{
+    uint32_t primask;
+
+    assert(pd < PD_COUNT);
+
+    primask = DA1469X_IRQ_DISABLE();
+    *up = g_da1469x_pd_data[pd].up_latency;
+    *down = g_da1469x_pd_data[pd].down_latency;
+    DA1469X_IRQ_ENABLE(primask);
+}
@@ -48,6 +48,16 @@ int da1469x_pd_acquire_noconf(uint8_t pd);
 int da1469x_pd_release(uint8_t pd);
 int da1469x_pd_release_nowait(uint8_t pd);
 
+struct da1469x_latency_hist;
+
+/*
+ * Get histograms of the time, in lp clock ticks, a power domain took to power
+ * up in da1469x_pd_acquire() and to power down in da1469x_pd_release(). Only
+ * transitions made while PD_TIM is acquired are timed.
+ */
+void da1469x_pd_get_latency(uint8_t pd, struct da1469x_latency_hist *up,
+                            struct da1469x_latency_hist *down);
+
 #ifdef __cplusplus
 }
 #endif
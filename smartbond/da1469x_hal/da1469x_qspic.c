@@ -19,6 +19,8 @@
 
 #include <da1469x_qspic.h>
 #include <assert.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
 
 /*
  * JEDEC commands that should be supported by all NOR and PSRAM
@@ -28,6 +30,21 @@
 #define MEMORY_JEDEC_RESET_CMD     0x99
 #define MEMORY_JEDEC_READ_ID_CMD   0x9F
 
+/* Data phases shorter than this are moved by the CPU even when a DMA channel is given */
+#define QSPI_DMA_MIN_LEN           64
+/* DMAx_LEN_REG holds the number of transfers minus one */
+#define QSPI_DMA_MAX_WORDS         0x10000
+
+/* Value of the burst TX_MD/RX_MD fields for each bus mode */
+#define QSPI_BURST_BUS_MODE(_mode) \
+    ((_mode) == QSPI_BUS_MODE_QUAD ? 2 : ((_mode) == QSPI_BUS_MODE_DUAL ? 1 : 0))
+
+#define QSPIC_BURSTCMDA_REG_SET_FIELD(_field, _var, _val)	\
+	((_var)) =	\
+	((_var) & ~(QSPIC_QSPIC_BURSTCMDA_REG_ ## _field ## _Msk)) | 	\
+	(((_val) << QSPIC_QSPIC_BURSTCMDA_REG_ ## _field ## _Pos) & 	\
+	QSPIC_QSPIC_BURSTCMDA_REG_ ## _field ## _Msk)
+
 #define QSPIC_BURSTCMDB_REG_SET_FIELD(_field, _var, _val)	\
 	((_var)) =	\
 	((_var) & ~(QSPIC_QSPIC_BURSTCMDB_REG_ ## _field ## _Msk)) | 	\
@@ -52,6 +69,14 @@
 	(((_val) << QSPIC2_QSPIC2_MEMBLEN_REG_ ## _field ## _Pos) & 	\
 	QSPIC2_QSPIC2_MEMBLEN_REG_ ## _field ## _Msk)
 
+static qspi_xfer_stats_t qspi_stats[2];
+
+static inline qspi_xfer_stats_t *
+qspi_get_stats(QSPIC_TYPE qspi_id)
+{
+    return &qspi_stats[qspi_id == QSPIC2_ID ? 1 : 0];
+}
+
 static inline void
 qspi_set_cs_state(QSPIC_TYPE qspi_id, bool state)
 {
@@ -78,6 +103,90 @@ qspi_read8_data(QSPIC_TYPE qspi_id)
     return *reg8;
 }
 
+/*
+ * A 32-bit access to the data registers clocks four bytes; the byte at the
+ * lowest address is sent/received first, so buffers keep their memory order.
+ */
+static inline void
+qspi_write32_data(QSPIC_TYPE qspi_id, uint32_t data)
+{
+    qspi_id->QSPIC_WRITEDATA_REG = data;
+}
+
+static inline uint32_t
+qspi_read32_data(QSPIC_TYPE qspi_id)
+{
+    return qspi_id->QSPIC_READDATA_REG;
+}
+
+static void
+qspi_write_data(QSPIC_TYPE qspi_id, const uint8_t *wbuf, size_t wlen)
+{
+    uint32_t word;
+    size_t i = 0;
+
+    for (; i + 4 <= wlen; i += 4) {
+        memcpy(&word, &wbuf[i], sizeof(word));
+        qspi_write32_data(qspi_id, word);
+    }
+
+    for (; i < wlen; i++) {
+        qspi_write8_data(qspi_id, wbuf[i]);
+    }
+}
+
+static void
+qspi_read_data(QSPIC_TYPE qspi_id, uint8_t *rbuf, size_t rlen)
+{
+    uint32_t word;
+    size_t i = 0;
+
+    for (; i + 4 <= rlen; i += 4) {
+        word = qspi_read32_data(qspi_id);
+        memcpy(&rbuf[i], &word, sizeof(word));
+    }
+
+    for (; i < rlen; i++) {
+        rbuf[i] = qspi_read8_data(qspi_id);
+    }
+}
+
+/*
+ * Move whole words between memory and a QSPIC data register with a DMA
+ * channel in memory-to-memory mode. The controller stalls each bus access
+ * until the word has been clocked, so no request line is needed.
+ */
+static void
+qspi_dma_data(QSPIC_TYPE qspi_id, uint8_t dma_channel, uint8_t *buf, size_t words, bool read)
+{
+    volatile uint32_t *ch = &DMA->DMA0_A_START_REG + (dma_channel * 8);
+    volatile uint32_t *data_reg = read ? &qspi_id->QSPIC_READDATA_REG : &qspi_id->QSPIC_WRITEDATA_REG;
+    size_t count;
+
+    assert(dma_channel < 8);
+    assert(((uint32_t)buf & 3) == 0);
+
+    while (words) {
+        count = MIN(words, QSPI_DMA_MAX_WORDS);
+
+        /* A_START is the source, B_START the destination */
+        ch[0] = read ? (uint32_t)data_reg : (uint32_t)buf;
+        ch[1] = read ? (uint32_t)buf : (uint32_t)data_reg;
+        ch[2] = count - 1;
+        ch[3] = count - 1;
+        ch[4] = (2 << DMA_DMA0_CTRL_REG_BW_Pos) |
+                (read ? DMA_DMA0_CTRL_REG_BINC_Msk : DMA_DMA0_CTRL_REG_AINC_Msk) |
+                DMA_DMA0_CTRL_REG_DMA_ON_Msk;
+
+        while (ch[4] & DMA_DMA0_CTRL_REG_DMA_ON_Msk) {
+        }
+        DMA->DMA_CLEAR_INT_REG = 1 << dma_channel;
+
+        buf += count * 4;
+        words -= count;
+    }
+}
+
 static void
 qspi_write(QSPIC_TYPE qspi_id, const uint8_t *wbuf, size_t wlen)
 {
@@ -85,9 +194,7 @@ qspi_write(QSPIC_TYPE qspi_id, const uint8_t *wbuf, size_t wlen)
 
     qspi_set_cs_state(qspi_id, true);
 
-    for (int i = 0; i < wlen; i++) {
-        qspi_write8_data(qspi_id, wbuf[i]);
-    }
+    qspi_write_data(qspi_id, wbuf, wlen);
 
     qspi_set_cs_state(qspi_id, false);
 }
@@ -99,15 +206,56 @@ qspi_transact(QSPIC_TYPE qspi_id, const uint8_t *wbuf, size_t wlen, uint8_t *rbu
 
     qspi_set_cs_state(qspi_id, true);
 
-    for (int i = 0; i < wlen; i++) {
-        qspi_write8_data(qspi_id, wbuf[i]);
+    qspi_write_data(qspi_id, wbuf, wlen);
+    qspi_read_data(qspi_id, rbuf, rlen);
+
+    qspi_set_cs_state(qspi_id, false);
+}
+
+static void
+qspi_manual_xfer(QSPIC_TYPE qspi_id, const uint8_t *cmd, size_t cmd_len,
+                 qspi_bus_mode_t data_mode, uint8_t *buf, size_t len, int dma_channel,
+                 bool read)
+{
+	assert((qspi_id->QSPIC_CTRLMODE_REG & QSPIC_QSPIC_CTRLMODE_REG_QSPIC_AUTO_MD_Msk) == 0);
+
+    qspi_xfer_stats_t *stats = qspi_get_stats(qspi_id);
+    uint32_t start = DWT->CYCCNT;
+    size_t head = 0;
+    size_t words = 0;
+
+    if (dma_channel >= 0 && len >= QSPI_DMA_MIN_LEN) {
+        /* Leading bytes up to the first word boundary go through the CPU */
+        head = (4 - ((uint32_t)buf & 3)) & 3;
+        words = (len - head) / 4;
     }
 
-    for (int i = 0; i < rlen; i++) {
-        rbuf[i] = qspi_read8_data(qspi_id);
+    qspi_set_cs_state(qspi_id, true);
+
+    qspi_write_data(qspi_id, cmd, cmd_len);
+    da1469x_qspi_set_bus_mode(qspi_id, data_mode);
+
+    if (words) {
+        if (read) {
+            qspi_read_data(qspi_id, buf, head);
+        } else {
+            qspi_write_data(qspi_id, buf, head);
+        }
+        qspi_dma_data(qspi_id, dma_channel, &buf[head], words, read);
+        stats->dma_xfers++;
+    }
+
+    head += words * 4;
+    if (read) {
+        qspi_read_data(qspi_id, &buf[head], len - head);
+    } else {
+        qspi_write_data(qspi_id, &buf[head], len - head);
     }
 
     qspi_set_cs_state(qspi_id, false);
+
+    stats->bytes += len;
+    stats->cycles += DWT->CYCCNT - start;
 }
 
 void
@@ -219,3 +367,66 @@ da1469x_qspi_set_tcem(uint32_t sys_clock_freq, uint32_t tcem_us)
     QSPIC_MEMBLEN_REG_SET_FIELD(QSPIC_T_CEM_CC, qspic_mmemblen_reg, cs_active_max_cyc);
     QSPIC2->QSPIC2_MEMBLEN_REG = qspic_mmemblen_reg;
 }
+
+void
+da1469x_qspi_manual_read(QSPIC_TYPE qspi_id, const uint8_t *cmd, size_t cmd_len,
+                         qspi_bus_mode_t data_mode, uint8_t *rbuf, size_t rlen,
+                         int dma_channel)
+{
+    qspi_manual_xfer(qspi_id, cmd, cmd_len, data_mode, rbuf, rlen, dma_channel, true);
+}
+
+void
+da1469x_qspi_manual_write(QSPIC_TYPE qspi_id, const uint8_t *cmd, size_t cmd_len,
+                          qspi_bus_mode_t data_mode, const uint8_t *wbuf, size_t wlen,
+                          int dma_channel)
+{
+    qspi_manual_xfer(qspi_id, cmd, cmd_len, data_mode, (uint8_t *)wbuf, wlen, dma_channel,
+                     false);
+}
+
+void
+da1469x_qspi_set_burst(QSPIC_TYPE qspi_id, const qspi_burst_cfg_t *cfg)
+{
+    uint32_t reg = qspi_id->QSPIC_BURSTCMDA_REG;
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_INST, reg, cfg->inst);
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_EXT_BYTE, reg, cfg->extra_byte);
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_INST_TX_MD, reg, QSPI_BURST_BUS_MODE(cfg->inst_mode));
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_ADR_TX_MD, reg, QSPI_BURST_BUS_MODE(cfg->addr_mode));
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_EXT_TX_MD, reg, QSPI_BURST_BUS_MODE(cfg->addr_mode));
+    QSPIC_BURSTCMDA_REG_SET_FIELD(QSPIC_DMY_TX_MD, reg, QSPI_BURST_BUS_MODE(cfg->addr_mode));
+    qspi_id->QSPIC_BURSTCMDA_REG = reg;
+
+    /* #CS high time set by da1469x_qspi_set_cs_delay() is kept */
+    reg = qspi_id->QSPIC_BURSTCMDB_REG;
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_DAT_RX_MD, reg, QSPI_BURST_BUS_MODE(cfg->data_mode));
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_EXT_BYTE_EN, reg, cfg->extra_byte_en);
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_EXT_HF_DS, reg, 0);
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_INST_MD, reg, cfg->inst_once);
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_WRAP_MD, reg, 0);
+    /* DMY_NUM encodes 0, 1, 2 or 4 dummy bytes; 3 needs DMY_FORCE */
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_DMY_FORCE, reg, cfg->dummy_bytes == 3);
+    QSPIC_BURSTCMDB_REG_SET_FIELD(QSPIC_DMY_NUM, reg,
+                                  cfg->dummy_bytes >= 4 ? 3 : (cfg->dummy_bytes == 3 ? 0 : cfg->dummy_bytes));
+    qspi_id->QSPIC_BURSTCMDB_REG = reg;
+
+    reg = qspi_id->QSPIC_CTRLMODE_REG;
+    QSPIC_CTRLMODE_REG_SET_FIELD(QSPIC_USE_32BA, reg, cfg->addr_32bit);
+    qspi_id->QSPIC_CTRLMODE_REG = reg;
+}
+
+void
+da1469x_qspi_get_stats(QSPIC_TYPE qspi_id, qspi_xfer_stats_t *stats)
+{
+    *stats = *qspi_get_stats(qspi_id);
+}
+
+uint32_t
+da1469x_qspi_stats_kbps(const qspi_xfer_stats_t *stats, uint32_t sys_clock_freq)
+{
+    if (stats->cycles == 0) {
+        return 0;
+    }
+
+    return (uint32_t)(((uint64_t)stats->bytes * sys_clock_freq) / stats->cycles / 1000);
+}
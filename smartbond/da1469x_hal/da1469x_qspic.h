@@ -37,6 +37,26 @@ typedef __PACKED_STRUCT qspi_memory_id {
     uint8_t density;
 } qspi_memory_id_t;
 
+/* Automatic mode read burst settings */
+typedef struct qspi_burst_cfg {
+    uint8_t inst;                  /* Read instruction */
+    qspi_bus_mode_t inst_mode;     /* Bus mode of the instruction */
+    qspi_bus_mode_t addr_mode;     /* Bus mode of the address, extra and dummy bytes */
+    qspi_bus_mode_t data_mode;     /* Bus mode of the data */
+    uint8_t dummy_bytes;           /* Number of dummy bytes, 0 to 4 */
+    bool extra_byte_en;            /* Send extra_byte after the address */
+    uint8_t extra_byte;            /* Mode byte, e.g. for continuous read */
+    bool inst_once;                /* Send the instruction in the first burst only */
+    bool addr_32bit;               /* Use 4-byte addresses */
+} qspi_burst_cfg_t;
+
+/* Manual mode data transfer counters */
+typedef struct qspi_xfer_stats {
+    uint32_t bytes;                /* Data bytes moved */
+    uint64_t cycles;               /* CPU cycles spent, measured with DWT->CYCCNT */
+    uint32_t dma_xfers;            /* Transfers that used DMA */
+} qspi_xfer_stats_t;
+
 /**
  * QSPICx enable and set read pipe delay.
  *
@@ -168,3 +188,93 @@ da1469x_qspi_memory_jedec_read_id(QSPIC_TYPE qspi_id, qspi_memory_id_t *id);
  */
 void
 da1469x_qspi_enter_exit_qpi_mode(QSPIC_TYPE qspi_id, bool enter, uint8_t cmd);
+
+/**
+ * Read data from the memory device in manual mode
+ *
+ * Calling this routine will send \p cmd (instruction, address and dummy bytes) in the current
+ * bus mode, switch to \p data_mode and read \p rlen bytes. Data is moved in 32-bit words. When
+ * \p dma_channel is not negative and the transfer is large enough, the whole words are moved
+ * by that DMA channel, which must not be in use.
+ *
+ * @param qspic_id        ID to designate the QSPIC for which the memory device is connected to.
+ *                        Valid values are QSPIC_ID and QSPIC2_ID.
+ * @param cmd             Command bytes
+ * @param cmd_len         Number of command bytes
+ * @param data_mode       Bus mode of the data phase. The controller is left in this mode.
+ * @param rbuf            Buffer the data is stored to
+ * @param rlen            Number of bytes to read
+ * @param dma_channel     DMA channel (0-7) to use, or -1 to move all data with the CPU.
+ *
+ * @warning This API should be called only when the controller is in manual mode. Otherwise, an
+ *          assertion will be thrown.
+ *
+ */
+void
+da1469x_qspi_manual_read(QSPIC_TYPE qspi_id, const uint8_t *cmd, size_t cmd_len,
+                         qspi_bus_mode_t data_mode, uint8_t *rbuf, size_t rlen,
+                         int dma_channel);
+
+/**
+ * Write data to the memory device in manual mode
+ *
+ * Same as da1469x_qspi_manual_read() with the data phase sent to the device.
+ *
+ * @param qspic_id        ID to designate the QSPIC for which the memory device is connected to.
+ *                        Valid values are QSPIC_ID and QSPIC2_ID.
+ * @param cmd             Command bytes
+ * @param cmd_len         Number of command bytes
+ * @param data_mode       Bus mode of the data phase. The controller is left in this mode.
+ * @param wbuf            Data to write
+ * @param wlen            Number of bytes to write
+ * @param dma_channel     DMA channel (0-7) to use, or -1 to move all data with the CPU.
+ *
+ * @warning This API should be called only when the controller is in manual mode. Otherwise, an
+ *          assertion will be thrown.
+ *
+ */
+void
+da1469x_qspi_manual_write(QSPIC_TYPE qspi_id, const uint8_t *cmd, size_t cmd_len,
+                          qspi_bus_mode_t data_mode, const uint8_t *wbuf, size_t wlen,
+                          int dma_channel);
+
+/**
+ * QSPICx set automatic mode read burst
+ *
+ * Calling this routine will configure the command sequence the controller issues for memory
+ * mapped reads, so that e.g. quad I/O fast reads with continuous read mode can be used.
+ *
+ * @param qspic_id        ID to designate the QSPIC for which the burst settings will be applied to.
+ *                        Valid values are QSPIC_ID and QSPIC2_ID.
+ * @param cfg             Burst settings
+ *
+ * @note This API should be called prior to switching to the auto mode. The #CS high time set by
+ *       da1469x_qspi_set_cs_delay() and the read buffer limit setting (BUF_LIM_EN) are kept.
+ *
+ */
+void
+da1469x_qspi_set_burst(QSPIC_TYPE qspi_id, const qspi_burst_cfg_t *cfg);
+
+/**
+ * QSPICx get manual mode transfer counters
+ *
+ * @param qspic_id        ID to designate the QSPIC. Valid values are QSPIC_ID and QSPIC2_ID.
+ * @param stats           Pointer to a structure the counters are copied to
+ *
+ * @note Cycles are only counted while the DWT cycle counter is enabled.
+ *
+ */
+void
+da1469x_qspi_get_stats(QSPIC_TYPE qspi_id, qspi_xfer_stats_t *stats);
+
+/**
+ * Throughput achieved by manual mode transfers
+ *
+ * @param stats           Counters returned by da1469x_qspi_get_stats()
+ * @param sys_clock_freq  Current system clock frequency.
+ *
+ * @return Throughput in kB/s, 0 if no cycles were counted.
+ *
+ */
+uint32_t
+da1469x_qspi_stats_kbps(const qspi_xfer_stats_t *stats, uint32_t sys_clock_freq);
@@ -18,6 +18,7 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include <DA1469xAB.h>
 #include <da1469x_config.h>
 #include <da1469x_clock.h>
@@ -29,6 +30,25 @@ static int pdc_idx_combo;
 static bool wait_for_jtag;
 static struct da1469x_sleep_config sleep_config;
 static uint32_t sys_clock_selection;
+static struct da1469x_sleep_stats sleep_stats;
+
+/* lp clock timer at WFI and at wakeup, written by da1469x_sleep_asm.S */
+extern uint32_t da1469x_sleep_ts[2];
+
+void da1469x_latency_hist_add(struct da1469x_latency_hist *hist, uint32_t ticks)
+{
+    uint32_t bin = ticks ? 32 - __CLZ(ticks) : 0;
+
+    if (bin >= DA1469X_LATENCY_HIST_BINS) {
+        bin = DA1469X_LATENCY_HIST_BINS - 1;
+    }
+
+    hist->bins[bin]++;
+    hist->count++;
+    if (ticks > hist->max) {
+        hist->max = ticks;
+    }
+}
 
 static bool da1469x_is_wakeup_by_jtag(void)
 {
@@ -54,8 +74,14 @@ static bool da1469x_is_sleep_allowed(void)
            !((NVIC->ISPR[0] & NVIC->ISER[0]) | (NVIC->ISPR[1] & NVIC->ISER[1]));
 }
 
-int da1469x_sleep(void)
+/*
+ * Sleep entered at entry_ts. If wake_ts is not NULL, it is the lp clock timer
+ * value the next event is due at, and the time the wakeup handler runs after
+ * it is recorded as hardware wakeup latency.
+ */
+static int da1469x_sleep_from(uint32_t entry_ts, const uint32_t *wake_ts)
 {
+    uint32_t late;
     int slept = 0;
 
     if (!da1469x_is_sleep_allowed()) {
@@ -93,6 +119,23 @@ int da1469x_sleep(void)
                 da1469x_clock_sys_pll_enable();
                 da1469x_clock_sys_pll_switch();
             }
+
+            da1469x_latency_hist_add(&sleep_stats.entry,
+                                     da1469x_lp_timer_diff(entry_ts, da1469x_sleep_ts[0]));
+            da1469x_latency_hist_add(&sleep_stats.sleep,
+                                     da1469x_lp_timer_diff(da1469x_sleep_ts[0], da1469x_sleep_ts[1]));
+            da1469x_latency_hist_add(&sleep_stats.exit,
+                                     da1469x_lp_timer_diff(da1469x_sleep_ts[1],
+                                                           da1469x_lp_timer_get()));
+            if (wake_ts) {
+                /* Woken up before the event by another source if negative */
+                late = da1469x_lp_timer_diff(*wake_ts, da1469x_sleep_ts[1]);
+                if (late <= (TIMER2_TIMER2_TIMER_VAL_REG_TIM_TIMER_VALUE_Msk >> 1)) {
+                    da1469x_latency_hist_add(&sleep_stats.wake, late);
+                }
+            }
+        } else {
+            sleep_stats.aborted++;
         }
     }
 
@@ -107,6 +150,11 @@ int da1469x_sleep(void)
     return slept;
 }
 
+int da1469x_sleep(void)
+{
+    return da1469x_sleep_from(da1469x_lp_timer_get(), NULL);
+}
+
 void da1469x_sleep_config(const struct da1469x_sleep_config *config)
 {
     sleep_config = *config;
@@ -117,3 +165,47 @@ void da1469x_sleep_config(const struct da1469x_sleep_config *config)
     da1469x_pdc_set(pdc_idx_combo);
     da1469x_pdc_ack(pdc_idx_combo);
 }
+
+uint32_t da1469x_sleep_latency(void)
+{
+    if (sleep_stats.exit.count == 0) {
+        return DA1469X_SLEEP_LATENCY_DEFAULT;
+    }
+
+    return sleep_stats.entry.max + sleep_stats.wake.max + sleep_stats.exit.max;
+}
+
+int da1469x_sleep_until(uint32_t ticks)
+{
+    uint32_t entry_ts = da1469x_lp_timer_get();
+    uint32_t wake_ts;
+
+    if (ticks <= da1469x_sleep_latency()) {
+        sleep_stats.shallow++;
+        __DMB();
+        __WFI();
+        return 0;
+    }
+
+    wake_ts = (entry_ts + ticks) & TIMER2_TIMER2_TIMER_VAL_REG_TIM_TIMER_VALUE_Msk;
+
+    return da1469x_sleep_from(entry_ts, &wake_ts);
+}
+
+void da1469x_sleep_get_stats(struct da1469x_sleep_stats *stats)
+{
+    uint32_t primask;
+
+    primask = DA1469X_IRQ_DISABLE();
+    *stats = sleep_stats;
+    DA1469X_IRQ_ENABLE(primask);
+}
+
+void da1469x_sleep_reset_stats(void)
+{
+    uint32_t primask;
+
+    primask = DA1469X_IRQ_DISABLE();
+    memset(&sleep_stats, 0, sizeof(sleep_stats));
+    DA1469X_IRQ_ENABLE(primask);
+}
@@ -20,6 +20,7 @@
 #ifndef __DA1469X_SLEEP_H
 #define __DA1469X_SLEEP_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <DA1469xAB.h>
 
@@ -27,14 +28,72 @@
 extern "C" {
 #endif
 
+/* Number of histogram bins; bin n counts latencies of [2^(n-1), 2^n) lp clock ticks */
+#define DA1469X_LATENCY_HIST_BINS           12
+
+/* Sleep entry plus exit latency assumed until a sleep has been measured, in lp clock ticks */
+#define DA1469X_SLEEP_LATENCY_DEFAULT       64
+
 struct da1469x_sleep_config {
     bool enable_xtal_on_wakeup;
 };
 
+struct da1469x_latency_hist {
+    uint32_t bins[DA1469X_LATENCY_HIST_BINS];
+    uint32_t max;
+    uint32_t count;
+};
+
+struct da1469x_sleep_stats {
+    /* da1469x_sleep() called until WFI */
+    struct da1469x_latency_hist entry;
+    /* WFI until the wakeup handler runs */
+    struct da1469x_latency_hist sleep;
+    /* Event passed to da1469x_sleep_until() until the wakeup handler runs */
+    struct da1469x_latency_hist wake;
+    /* Wakeup handler until PD_SYS and the system clock are restored */
+    struct da1469x_latency_hist exit;
+    /* WFI returned without the SoC entering deep sleep */
+    uint32_t aborted;
+    /* Deep sleep skipped by da1469x_sleep_until() because the next event was too close */
+    uint32_t shallow;
+};
+
+/*
+ * Timestamps are taken from TIMER2, which runs from the lp clock and keeps
+ * counting in sleep. Its counter is 24 bits wide.
+ */
+static inline uint32_t
+da1469x_lp_timer_get(void)
+{
+    return TIMER2->TIMER2_TIMER_VAL_REG & TIMER2_TIMER2_TIMER_VAL_REG_TIM_TIMER_VALUE_Msk;
+}
+
+static inline uint32_t
+da1469x_lp_timer_diff(uint32_t from, uint32_t to)
+{
+    return (to - from) & TIMER2_TIMER2_TIMER_VAL_REG_TIM_TIMER_VALUE_Msk;
+}
+
+void da1469x_latency_hist_add(struct da1469x_latency_hist *hist, uint32_t ticks);
+
 void da1469x_sleep_config(const struct da1469x_sleep_config *config);
 int da1469x_sleep(void);
 void da1469x_wakeup_handler(void);
 
+/*
+ * Enter extended sleep only if the next event is further away, in lp clock
+ * ticks, than the measured sleep latency. Otherwise just wait for an
+ * interrupt.
+ */
+int da1469x_sleep_until(uint32_t ticks);
+
+/* Worst measured entry, hardware wakeup and exit latency, in lp clock ticks */
+uint32_t da1469x_sleep_latency(void);
+
+void da1469x_sleep_get_stats(struct da1469x_sleep_stats *stats);
+void da1469x_sleep_reset_stats(void);
+
 int da1469x_enter_sleep(void);
 
 #ifdef __cplusplus
@@ -12,6 +12,7 @@ extern "C" {
 
 #define GLCDC_CFG_PARAM_CHECKING_ENABLE      (BSP_CFG_PARAM_CHECKING_ENABLE)
 #define GLCDC_CFG_COLOR_CORRECTION_ENABLE    (true)
+#define GLCDC_CFG_FLIP_QUEUE_DEPTH           (3)
 
 /* Disable DSI function handling */
 #ifdef GLCDC_CFG_USING_DSI
@@ -0,0 +1,18 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#ifndef RM_ADC_PIPELINE_CFG_H_
+#define RM_ADC_PIPELINE_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADC_PIPELINE_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* RM_ADC_PIPELINE_CFG_H_ */
@@ -0,0 +1,18 @@
+/*
+* Copyright (c) 2020 - 2025 Renesas Electronics Corporation and/or its affiliates
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#ifndef RM_DISPLAY_DIRTY_CFG_H_
+#define RM_DISPLAY_DIRTY_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISPLAY_DIRTY_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* RM_DISPLAY_DIRTY_CFG_H_ */